@@ -125,7 +125,8 @@ template<typename A> parser::Label GetErr(const A &stmt) {
     }
   }
   if constexpr (std::is_same_v<A, parser::InquireStmt>) {
-    for (const auto &spec : std::get<std::list<parser::InquireSpec>>(stmt.u)) {
+    for (const auto &spec :
+        std::get<parser::List<parser::InquireSpec>>(stmt.u)) {
       if (std::holds_alternative<parser::ErrLabel>(spec.u)) {
         return std::get<parser::ErrLabel>(spec.u).v;
       }
@@ -234,7 +235,7 @@ std::vector<LabelRef> toLabelRef(
 }
 
 static bool hasAltReturns(const parser::CallStmt &callStmt) {
-  const auto &args{std::get<std::list<parser::ActualArgSpec>>(callStmt.v.t)};
+  const auto &args{std::get<parser::List<parser::ActualArgSpec>>(callStmt.v.t)};
   for (const auto &arg : args) {
     const auto &actual{std::get<parser::ActualArg>(arg.t)};
     if (std::holds_alternative<parser::AltReturnSpec>(actual.u)) {
@@ -244,9 +245,10 @@ static bool hasAltReturns(const parser::CallStmt &callStmt) {
   return false;
 }
 
-static std::list<parser::Label> getAltReturnLabels(const parser::Call &call) {
-  std::list<parser::Label> result;
-  const auto &args{std::get<std::list<parser::ActualArgSpec>>(call.t)};
+static parser::List<parser::Label> getAltReturnLabels(
+    const parser::Call &call) {
+  parser::List<parser::Label> result;
+  const auto &args{std::get<parser::List<parser::ActualArgSpec>>(call.t)};
   for (const auto &arg : args) {
     const auto &actual{std::get<parser::ActualArg>(arg.t)};
     if (const auto *p{std::get_if<parser::AltReturnSpec>(&actual.u)}) {
@@ -360,7 +362,7 @@ void Op::Build(std::list<Op> &ops,
           [&](const common::Indirection<parser::ComputedGotoStmt> &s) {
             auto next{BuildNewLabel(ad)};
             auto labels{toLabelRef(
-                next, ad, std::get<std::list<parser::Label>>(s.value().t))};
+                next, ad, std::get<parser::List<parser::Label>>(s.value().t))};
             ops.emplace_back(SwitchOp{s.value(), std::move(labels), ec.source});
             ops.emplace_back(next);
           },
@@ -374,8 +376,9 @@ void Op::Build(std::list<Op> &ops,
           [&](const common::Indirection<parser::AssignedGotoStmt> &s) {
             ops.emplace_back(
                 IndirectGotoOp{std::get<parser::Name>(s.value().t).symbol,
-                    toLabelRef(
-                        ad, std::get<std::list<parser::Label>>(s.value().t))});
+                    toLabelRef(ad,
+                        std::get<parser::List<parser::Label>>(
+                            s.value().t))});
           },
           [&](const common::Indirection<parser::IfStmt> &s) {
             auto then{BuildNewLabel(ad)};
@@ -539,7 +542,7 @@ struct ControlFlowAnalyzer {
     LabelRef exitOpRef{GetLabelRef(exitLab)};
     ops.emplace_back(GotoOp{exitOpRef});
     for (const auto &elseIfBlock :
-        std::get<std::list<parser::IfConstruct::ElseIfBlock>>(construct.t)) {
+        std::get<parser::List<parser::IfConstruct::ElseIfBlock>>(construct.t)) {
       appendIfLabeled(
           std::get<parser::Statement<parser::ElseIfStmt>>(elseIfBlock.t), ops);
       ops.emplace_back(elseLab);
@@ -580,10 +583,10 @@ struct ControlFlowAnalyzer {
         name, GetLabelRef(exitLab), UnspecifiedLabel);
     appendIfLabeled(std::get<0>(construct.t), ops);
     ops.emplace_back(BeginOp{construct});
-    const auto N{std::get<std::list<B>>(construct.t).size()};
+    const auto N{std::get<parser::List<B>>(construct.t).size()};
     LabelRef exitOpRef{GetLabelRef(exitLab)};
     if (N > 0) {
-      typename std::list<B>::size_type i;
+      typename parser::List<B>::size_type i;
       std::vector<LabelOp> toLabels;
       for (i = 0; i != N; ++i) {
         toLabels.emplace_back(buildNewLabel());
@@ -596,7 +599,7 @@ struct ControlFlowAnalyzer {
           SwitchOp{construct, targets, std::get<0>(construct.t).source});
       ControlFlowAnalyzer cfa{ops, ad};
       i = 0;
-      for (const auto &caseBlock : std::get<std::list<B>>(construct.t)) {
+      for (const auto &caseBlock : std::get<parser::List<B>>(construct.t)) {
         ops.emplace_back(toLabels[i++]);
         appendIfLabeled(std::get<0>(caseBlock.t), ops);
         Walk(std::get<parser::Block>(caseBlock.t), cfa);
@@ -625,9 +628,9 @@ struct ControlFlowAnalyzer {
         std::get<parser::Statement<parser::WhereConstructStmt>>(c.t), ops);
     ops.emplace_back(BeginOp{c});
     ControlFlowAnalyzer cfa{ops, ad};
-    Walk(std::get<std::list<parser::WhereBodyConstruct>>(c.t), cfa);
-    Walk(
-        std::get<std::list<parser::WhereConstruct::MaskedElsewhere>>(c.t), cfa);
+    Walk(std::get<parser::List<parser::WhereBodyConstruct>>(c.t), cfa);
+    Walk(std::get<parser::List<parser::WhereConstruct::MaskedElsewhere>>(c.t),
+        cfa);
     Walk(std::get<std::optional<parser::WhereConstruct::Elsewhere>>(c.t), cfa);
     ops.emplace_back(label);
     appendIfLabeled(
@@ -649,7 +652,7 @@ struct ControlFlowAnalyzer {
         ops);
     ops.emplace_back(BeginOp{construct});
     ControlFlowAnalyzer cfa{ops, ad};
-    Walk(std::get<std::list<parser::ForallBodyConstruct>>(construct.t), cfa);
+    Walk(std::get<parser::List<parser::ForallBodyConstruct>>(construct.t), cfa);
     ops.emplace_back(label);
     appendIfLabeled(
         std::get<parser::Statement<parser::EndForallStmt>>(construct.t), ops);
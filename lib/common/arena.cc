@@ -0,0 +1,117 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "arena.h"
+#include "idioms.h"
+#include <cstdlib>
+
+namespace Fortran::common {
+
+// Every block is preceded by a header that records whether it lives in
+// an arena.  The header's size preserves the alignment of the block.
+struct alignas(std::max_align_t) BlockHeader {
+  bool inArena;
+};
+
+static constexpr std::size_t RoundUp(std::size_t bytes) {
+  constexpr std::size_t align{alignof(std::max_align_t)};
+  return (bytes + align - 1) & ~(align - 1);
+}
+
+thread_local Arena *Arena::current_{nullptr};
+
+Arena::Arena(Arena &&that)
+  : pages_{std::move(that.pages_)}, next_{that.next_}, limit_{that.limit_},
+    bytes_{that.bytes_} {
+  that.pages_.clear();
+  that.next_ = that.limit_ = nullptr;
+  that.bytes_ = 0;
+}
+
+Arena &Arena::operator=(Arena &&that) {
+  if (this != &that) {
+    Release();
+    pages_ = std::move(that.pages_);
+    next_ = that.next_;
+    limit_ = that.limit_;
+    bytes_ = that.bytes_;
+    that.pages_.clear();
+    that.next_ = that.limit_ = nullptr;
+    that.bytes_ = 0;
+  }
+  return *this;
+}
+
+Arena::~Arena() { Release(); }
+
+void Arena::Release() {
+  for (char *page : pages_) {
+    std::free(page);
+  }
+  pages_.clear();
+  next_ = limit_ = nullptr;
+  bytes_ = 0;
+}
+
+void Arena::Adopt(Arena &&that) {
+  // This arena keeps allocating from its own current page.
+  pages_.insert(pages_.end(), that.pages_.begin(), that.pages_.end());
+  bytes_ += that.bytes_;
+  that.pages_.clear();
+  that.next_ = that.limit_ = nullptr;
+  that.bytes_ = 0;
+}
+
+void *Arena::AllocateHere(std::size_t bytes) {
+  bytes_ += bytes;
+  if (bytes > pageBytes / 4) {
+    // Large blocks get pages of their own, which are not bumped into.
+    char *page{static_cast<char *>(std::malloc(bytes))};
+    CHECK(page && "out of memory in Arena");
+    pages_.push_back(page);
+    return page;
+  }
+  if (static_cast<std::size_t>(limit_ - next_) < bytes) {
+    next_ = static_cast<char *>(std::malloc(pageBytes));
+    CHECK(next_ && "out of memory in Arena");
+    limit_ = next_ + pageBytes;
+    pages_.push_back(next_);
+  }
+  void *result{next_};
+  next_ += bytes;
+  return result;
+}
+
+void *Arena::Allocate(std::size_t bytes) {
+  bytes = RoundUp(bytes) + sizeof(BlockHeader);
+  BlockHeader *header;
+  if (current_) {
+    header = static_cast<BlockHeader *>(current_->AllocateHere(bytes));
+    header->inArena = true;
+  } else {
+    header = static_cast<BlockHeader *>(::operator new(bytes));
+    header->inArena = false;
+  }
+  return header + 1;
+}
+
+void Arena::Deallocate(void *p) {
+  if (p) {
+    BlockHeader *header{static_cast<BlockHeader *>(p) - 1};
+    if (!header->inArena) {
+      ::operator delete(header);
+    }
+  }
+}
+}
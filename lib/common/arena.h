@@ -0,0 +1,110 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FORTRAN_COMMON_ARENA_H_
+#define FORTRAN_COMMON_ARENA_H_
+
+// An Arena is a bump allocator whose pages are released all at once
+// when it is destroyed.  While an Arena::Scope is active, allocations
+// on its thread with Arena::Allocate(), Arena::New<>(), and ArenaAllocator<>
+// are made in its arena; otherwise they are made on the heap.  Each block
+// remembers where it came from, so blocks from arenas and from the heap
+// can be mixed freely, e.g. by splicing lists, and deallocating a block
+// that lives in an arena does nothing.  Objects allocated in an arena
+// must be destroyed before the arena is.
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Fortran::common {
+
+class Arena {
+public:
+  static constexpr std::size_t pageBytes{64 * 1024};
+
+  Arena() {}
+  Arena(const Arena &) = delete;
+  Arena(Arena &&);
+  Arena &operator=(const Arena &) = delete;
+  Arena &operator=(Arena &&);
+  ~Arena();
+
+  std::size_t bytes() const { return bytes_; }  // allocated in this arena
+
+  // Takes ownership of the pages of another arena
+  void Adopt(Arena &&);
+
+  // Makes an arena current on this thread for the lifetime of the Scope
+  class Scope {
+  public:
+    explicit Scope(Arena *arena) : previous_{current_} { current_ = arena; }
+    Scope(const Scope &) = delete;
+    ~Scope() { current_ = previous_; }
+
+  private:
+    Arena *previous_;
+  };
+
+  static void *Allocate(std::size_t);
+  static void Deallocate(void *);
+
+  template<typename A, typename... ARGS> static A *New(ARGS &&... args) {
+    static_assert(alignof(A) <= alignof(std::max_align_t));
+    return new (Allocate(sizeof(A))) A(std::forward<ARGS>(args)...);
+  }
+  template<typename A> static void Delete(A *p) {
+    if (p) {
+      p->~A();
+      Deallocate(p);
+    }
+  }
+
+private:
+  void *AllocateHere(std::size_t);
+  void Release();
+
+  static thread_local Arena *current_;
+  std::vector<char *> pages_;
+  char *next_{nullptr}, *limit_{nullptr};
+  std::size_t bytes_{0};
+};
+
+// A stateless allocator for standard containers; containers using it
+// are always interchangeable, whichever arenas their elements are in.
+template<typename A> class ArenaAllocator {
+public:
+  using value_type = A;
+  using is_always_equal = std::true_type;
+
+  ArenaAllocator() {}
+  template<typename B> ArenaAllocator(const ArenaAllocator<B> &) {}
+
+  A *allocate(std::size_t n) {
+    static_assert(alignof(A) <= alignof(std::max_align_t));
+    return static_cast<A *>(Arena::Allocate(n * sizeof(A)));
+  }
+  void deallocate(A *p, std::size_t) { Arena::Deallocate(p); }
+
+  template<typename B> bool operator==(const ArenaAllocator<B> &) const {
+    return true;
+  }
+  template<typename B> bool operator!=(const ArenaAllocator<B> &) const {
+    return false;
+  }
+};
+}
+#endif  // FORTRAN_COMMON_ARENA_H_
@@ -0,0 +1,63 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FORTRAN_COMMON_FINGERPRINT_H_
+#define FORTRAN_COMMON_FINGERPRINT_H_
+
+// A 128-bit FNV-1a hash of a sequence of byte strings, for identifying
+// the inputs of a computation by their contents, e.g. to key a cache.
+// Each string is hashed after its length, so that distinct sequences of
+// strings with the same concatenation have distinct fingerprints.
+
+#include "uint128.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Fortran::common {
+
+class Fingerprint {
+public:
+  Fingerprint &Add(std::string_view bytes) {
+    AddBytes(std::to_string(bytes.size()) + ':');
+    AddBytes(bytes);
+    return *this;
+  }
+
+  // 32 hexadecimal digits
+  std::string ToString() const {
+    static const char *digits{"0123456789abcdef"};
+    std::string result(32, '0');
+    uint128_t hash{hash_};
+    for (int j{32}; j-- > 0; hash >>= 4) {
+      result[j] = digits[static_cast<int>(hash & 0xf)];
+    }
+    return result;
+  }
+
+private:
+  void AddBytes(std::string_view bytes) {
+    for (char ch : bytes) {
+      hash_ ^= static_cast<std::uint8_t>(ch);
+      hash_ *= prime;
+    }
+  }
+
+  static constexpr uint128_t prime{
+      (uint128_t{std::uint64_t{0x0000000001000000}} << 64) | 0x13b};
+  uint128_t hash_{
+      (uint128_t{std::uint64_t{0x6c62272e07bb0142}} << 64) | 0x62b821756295c58d};
+};
+}
+#endif  // FORTRAN_COMMON_FINGERPRINT_H_
@@ -40,10 +40,11 @@
 #if __GNUC__ == 7
 // Avoid a deduction bug in GNU 7.x headers by forcing the answer.
 namespace std {
-template<typename A>
-struct is_trivially_copy_constructible<list<A>> : false_type {};
-template<typename A>
-struct is_trivially_copy_constructible<optional<list<A>>> : false_type {};
+template<typename A, typename ALLOC>
+struct is_trivially_copy_constructible<list<A, ALLOC>> : false_type {};
+template<typename A, typename ALLOC>
+struct is_trivially_copy_constructible<optional<list<A, ALLOC>>>
+  : false_type {};
 }
 #endif
 
@@ -19,6 +19,8 @@
 // non-nullable std::unique_ptr<>.  Indirection<> is, like a C++ reference
 // type, restricted to be non-null when constructed or assigned.
 // Indirection<> optionally supports copy construction and copy assignment.
+// The objects are allocated with Arena::New<>(), so they're placed in the
+// current thread's arena, if any.
 //
 // To use Indirection<> with forward-referenced types, add
 //    extern template class Fortran::common::Indirection<FORWARD_TYPE>;
@@ -26,6 +28,7 @@
 //    template class Fortran::common::Indirection<FORWARD_TYPE>;
 // in one C++ source file later where a definition of the type is visible.
 
+#include "arena.h"
 #include "idioms.h"
 #include <memory>
 #include <type_traits>
@@ -38,17 +41,18 @@ template<typename A, bool COPY = false> class Indirection {
 public:
   using element_type = A;
   Indirection() = delete;
+  // p must have been allocated by Arena::New<A>().
   Indirection(A *&&p) : p_{p} {
     CHECK(p_ && "assigning null pointer to Indirection");
     p = nullptr;
   }
-  Indirection(A &&x) : p_{new A(std::move(x))} {}
+  Indirection(A &&x) : p_{Arena::New<A>(std::move(x))} {}
   Indirection(Indirection &&that) : p_{that.p_} {
     CHECK(p_ && "move construction of Indirection from null Indirection");
     that.p_ = nullptr;
   }
   ~Indirection() {
-    delete p_;
+    Arena::Delete(p_);
     p_ = nullptr;
   }
   Indirection &operator=(Indirection &&that) {
@@ -67,7 +71,7 @@ public:
 
   template<typename... ARGS>
   static common::IfNoLvalue<Indirection, ARGS...> Make(ARGS &&... args) {
-    return {new A(std::move(args)...)};
+    return {Arena::New<A>(std::move(args)...)};
   }
 
 private:
@@ -80,22 +84,23 @@ public:
   using element_type = A;
 
   Indirection() = delete;
+  // p must have been allocated by Arena::New<A>().
   Indirection(A *&&p) : p_{p} {
     CHECK(p_ && "assigning null pointer to Indirection");
     p = nullptr;
   }
-  Indirection(const A &x) : p_{new A(x)} {}
-  Indirection(A &&x) : p_{new A(std::move(x))} {}
+  Indirection(const A &x) : p_{Arena::New<A>(x)} {}
+  Indirection(A &&x) : p_{Arena::New<A>(std::move(x))} {}
   Indirection(const Indirection &that) {
     CHECK(that.p_ && "copy construction of Indirection from null Indirection");
-    p_ = new A(*that.p_);
+    p_ = Arena::New<A>(*that.p_);
   }
   Indirection(Indirection &&that) : p_{that.p_} {
     CHECK(p_ && "move construction of Indirection from null Indirection");
     that.p_ = nullptr;
   }
   ~Indirection() {
-    delete p_;
+    Arena::Delete(p_);
     p_ = nullptr;
   }
   Indirection &operator=(const Indirection &that) {
@@ -119,7 +124,7 @@ public:
 
   template<typename... ARGS>
   static common::IfNoLvalue<Indirection, ARGS...> Make(ARGS &&... args) {
-    return {new A(std::move(args)...)};
+    return {Arena::New<A>(std::move(args)...)};
   }
 
 private:
@@ -0,0 +1,126 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "time-report.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ostream>
+#include <sys/resource.h>
+
+namespace Fortran::common {
+
+static double WallSeconds() {
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+static double CPUSeconds(const rusage &usage) {
+  return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+      (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1.0e-6;
+}
+
+TimeReport::Phase::Phase(TimeReport *report, const char *name)
+  : report_{report}, name_{name} {
+  if (report_) {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    cpu_ = CPUSeconds(usage);
+    wall_ = WallSeconds();
+  }
+}
+
+TimeReport::Phase::~Phase() {
+  if (report_) {
+    double wall{WallSeconds()};
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    report_->Add(Times{
+        name_, wall - wall_, CPUSeconds(usage) - cpu_, usage.ru_maxrss, 1});
+  }
+}
+
+void TimeReport::Add(const Times &times) {
+  auto iter{std::find_if(phases_.begin(), phases_.end(),
+      [&](const Times &x) { return x.name == times.name; })};
+  if (iter == phases_.end()) {
+    phases_.push_back(times);
+  } else {
+    iter->wall += times.wall;
+    iter->cpu += times.cpu;
+    iter->maxRSS = std::max(iter->maxRSS, times.maxRSS);
+    iter->count += times.count;
+  }
+}
+
+void TimeReport::Merge(const TimeReport &that) {
+  for (const auto &times : that.phases_) {
+    Add(times);
+  }
+}
+
+std::ostream &TimeReport::Dump(std::ostream &o) const {
+  char line[128];
+  std::snprintf(line, sizeof line, "%-24s %12s %12s %14s %6s\n", "Phase",
+      "Wall (s)", "CPU (s)", "Peak RSS (KiB)", "Count");
+  o << line;
+  double wall{0}, cpu{0};
+  long maxRSS{0};
+  for (const auto &times : phases_) {
+    std::snprintf(line, sizeof line, "%-24s %12.6f %12.6f %14ld %6d\n",
+        times.name.c_str(), times.wall, times.cpu, times.maxRSS, times.count);
+    o << line;
+    wall += times.wall;
+    cpu += times.cpu;
+    maxRSS = std::max(maxRSS, times.maxRSS);
+  }
+  std::snprintf(line, sizeof line, "%-24s %12.6f %12.6f %14ld\n", "Total",
+      wall, cpu, maxRSS);
+  return o << line;
+}
+
+static std::ostream &PutJSONString(std::ostream &o, const std::string &str) {
+  o << '"';
+  for (char ch : str) {
+    if (ch == '"' || ch == '\\') {
+      o << '\\' << ch;
+    } else if (static_cast<unsigned char>(ch) < ' ') {
+      char escape[8];
+      std::snprintf(escape, sizeof escape, "\\u%04x", ch);
+      o << escape;
+    } else {
+      o << ch;
+    }
+  }
+  return o << '"';
+}
+
+std::ostream &TimeReport::DumpJSON(
+    std::ostream &o, const std::string &file) const {
+  o << "{\"file\":";
+  PutJSONString(o, file) << ",\"phases\":[";
+  char times[128];
+  for (std::size_t j{0}; j < phases_.size(); ++j) {
+    const auto &phase{phases_[j]};
+    o << (j > 0 ? ",{\"name\":" : "{\"name\":");
+    std::snprintf(times, sizeof times,
+        ",\"wall\":%.6f,\"cpu\":%.6f,\"maxrss_kib\":%ld,\"count\":%d}",
+        phase.wall, phase.cpu, phase.maxRSS, phase.count);
+    PutJSONString(o, phase.name) << times;
+  }
+  return o << "]}\n";
+}
+}
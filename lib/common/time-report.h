@@ -0,0 +1,72 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef FORTRAN_COMMON_TIME_REPORT_H_
+#define FORTRAN_COMMON_TIME_REPORT_H_
+
+// Accumulates the wall clock and CPU times of named phases of a
+// compilation, along with the peak resident set size of the process
+// at the end of each, for -ftime-report.
+//
+// {
+//   TimeReport::Phase phase{report, "Parse"};  // report may be null
+//   ...
+// }
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace Fortran::common {
+
+class TimeReport {
+public:
+  class Phase {
+  public:
+    Phase(TimeReport *, const char *name);
+    Phase(const Phase &) = delete;
+    ~Phase();
+
+  private:
+    TimeReport *report_;
+    const char *name_;
+    double wall_{0}, cpu_{0};
+  };
+
+  template<typename F>
+  static auto Measure(TimeReport *report, const char *name, F f) {
+    Phase phase{report, name};
+    return f();
+  }
+
+  bool empty() const { return phases_.empty(); }
+  void Merge(const TimeReport &);
+  std::ostream &Dump(std::ostream &) const;
+  // One line: {"file":...,"phases":[{"name":...,"wall":...,...},...]}
+  std::ostream &DumpJSON(std::ostream &, const std::string &file) const;
+
+private:
+  struct Times {
+    std::string name;
+    double wall{0}, cpu{0};  // seconds
+    long maxRSS{0};  // KiB
+    int count{0};
+  };
+  void Add(const Times &);
+
+  std::vector<Times> phases_;  // in order of first appearance
+};
+}
+#endif  // FORTRAN_COMMON_TIME_REPORT_H_
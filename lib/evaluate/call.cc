@@ -65,8 +65,7 @@ bool ActualArgument::operator==(const ActualArgument &that) const {
 
 SpecificIntrinsic::SpecificIntrinsic(
     IntrinsicProcedure n, characteristics::Procedure &&chars)
-  : name{n}, characteristics{new characteristics::Procedure{std::move(chars)}} {
-}
+  : name{n}, characteristics{std::move(chars)} {}
 
 DEFINE_DEFAULT_CONSTRUCTORS_AND_ASSIGNMENTS(SpecificIntrinsic)
 
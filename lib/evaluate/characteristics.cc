@@ -310,7 +310,7 @@ std::ostream &DummyDataObject::Dump(std::ostream &o) const {
 }
 
 DummyProcedure::DummyProcedure(Procedure &&p)
-  : procedure{new Procedure{std::move(p)}} {}
+  : procedure{std::move(p)} {}
 
 bool DummyProcedure::operator==(const DummyProcedure &that) const {
   return attrs == that.attrs && intent == that.intent &&
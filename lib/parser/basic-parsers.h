@@ -29,6 +29,7 @@
 // template functions.  See parser-combinators.txt for documentation.
 
 #include "char-block.h"
+#include "list.h"
 #include "message.h"
 #include "parse-state.h"
 #include "provenance.h"
@@ -38,7 +39,6 @@
 #include "../common/indirection.h"
 #include <cstring>
 #include <functional>
-#include <list>
 #include <memory>
 #include <optional>
 #include <string>
@@ -404,7 +404,7 @@ template<typename PA> class ManyParser {
   using paType = typename PA::resultType;
 
 public:
-  using resultType = std::list<paType>;
+  using resultType = List<paType>;
   constexpr ManyParser(const ManyParser &) = default;
   constexpr ManyParser(PA parser) : parser_{parser} {}
   std::optional<resultType> Parse(ParseState &state) const {
@@ -436,7 +436,7 @@ template<typename PA> class SomeParser {
   using paType = typename PA::resultType;
 
 public:
-  using resultType = std::list<paType>;
+  using resultType = List<paType>;
   constexpr SomeParser(const SomeParser &) = default;
   constexpr SomeParser(PA parser) : parser_{parser} {}
   std::optional<resultType> Parse(ParseState &state) const {
@@ -759,7 +759,7 @@ template<typename PA> inline constexpr auto indirect(PA p) {
 // The result is the list of the values returned from all of the applications
 // of a.
 template<typename T>
-common::IfNoLvalue<std::list<T>, T> prepend(T &&head, std::list<T> &&rest) {
+common::IfNoLvalue<List<T>, T> prepend(T &&head, List<T> &&rest) {
   rest.push_front(std::move(head));
   return std::move(rest);
 }
@@ -769,7 +769,7 @@ private:
   using paType = typename PA::resultType;
 
 public:
-  using resultType = std::list<paType>;
+  using resultType = List<paType>;
   constexpr NonemptySeparated(const NonemptySeparated &) = default;
   constexpr NonemptySeparated(PA p, PB sep) : parser_{p}, separator_{sep} {}
   std::optional<resultType> Parse(ParseState &state) const {
@@ -0,0 +1,581 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "binary-parse-tree.h"
+#include "../common/idioms.h"
+#include "../common/indirection.h"
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// The trait-determined classes of the parse tree are encoded by their
+// "t", "u", "v", or "thing" members followed by their "source", if any,
+// much as parser::Walk() traverses them.  The other classes have their
+// members encoded in the order of the arguments of their constructors,
+// so that they can be decoded in a braced initializer list, whose
+// elements are evaluated in order.
+
+namespace Fortran::parser {
+
+void BinaryEncoder::PutUnsigned(std::uint64_t n) {
+  for (; n >= 0x80; n >>= 7) {
+    bytes_ += static_cast<char>((n & 0x7f) | 0x80);
+  }
+  bytes_ += static_cast<char>(n);
+}
+
+void BinaryEncoder::PutSigned(std::int64_t n) {
+  // Zig-zag encoding keeps small negative numbers short, too.
+  auto u{static_cast<std::uint64_t>(n)};
+  PutUnsigned((u << 1) ^ (n < 0 ? ~std::uint64_t{0} : 0));
+}
+
+void BinaryEncoder::PutString(std::string_view s) {
+  PutUnsigned(s.size());
+  bytes_.append(s.data(), s.size());
+}
+
+std::uint64_t BinaryDecoder::GetUnsigned() {
+  std::uint64_t result{0};
+  for (int shift{0};; shift += 7) {
+    CHECK(at_ < limit_ && shift < 64);
+    auto byte{static_cast<std::uint8_t>(*at_++)};
+    result |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      return result;
+    }
+  }
+}
+
+std::int64_t BinaryDecoder::GetSigned() {
+  std::uint64_t n{GetUnsigned()};
+  return static_cast<std::int64_t>((n >> 1) ^ (0 - (n & 1)));
+}
+
+std::string_view BinaryDecoder::GetString() {
+  std::uint64_t bytes{GetUnsigned()};
+  CHECK(bytes <= static_cast<std::uint64_t>(limit_ - at_));
+  std::string_view result{at_, static_cast<std::size_t>(bytes)};
+  at_ += bytes;
+  return result;
+}
+
+template<typename A, typename = void> constexpr bool HasSource{false};
+template<typename A>
+constexpr bool HasSource<A,
+    std::enable_if_t<
+        std::is_same_v<decltype(std::declval<A &>().source), CharBlock &>>>{
+    true};
+
+template<typename A> constexpr bool IsLeaf{
+    std::is_enum_v<A> || std::is_integral_v<A>};
+
+class ParseTreeEncoder {
+public:
+  ParseTreeEncoder(BinaryEncoder &out, const CookedSource &cooked)
+    : out_{out}, start_{cooked.data().data()}, size_{cooked.data().size()} {}
+
+  bool ok() const { return ok_; }
+
+  template<typename A> void Put(const A &x) {
+    if constexpr (std::is_enum_v<A>) {
+      out_.PutSigned(static_cast<std::int64_t>(x));
+    } else if constexpr (std::is_integral_v<A> && std::is_signed_v<A>) {
+      out_.PutSigned(x);
+    } else if constexpr (std::is_integral_v<A>) {
+      out_.PutUnsigned(x);
+    } else if constexpr (EmptyTrait<A>) {
+    } else if constexpr (WrapperTrait<A>) {
+      Put(x.v);
+    } else if constexpr (TupleTrait<A>) {
+      Put(x.t);
+    } else if constexpr (UnionTrait<A>) {
+      Put(x.u);
+    } else if constexpr (ConstraintTrait<A>) {
+      Put(x.thing);
+    } else {
+      static_assert(IsLeaf<A>, "parse tree class cannot be encoded");
+    }
+    if constexpr (std::is_class_v<A>) {
+      if constexpr (HasSource<A>) {
+        Put(x.source);
+      }
+    }
+  }
+
+  void Put(const std::string &x) { out_.PutString(x); }
+  void Put(const char *x) {
+    if (!x) {
+      out_.PutUnsigned(0);
+    } else if (x >= start_ && x <= start_ + size_) {
+      out_.PutUnsigned(x - start_ + 1);
+    } else {
+      ok_ = false;
+    }
+  }
+  void Put(const CharBlock &x) {
+    Put(x.begin());
+    if (x.begin()) {
+      if (x.end() <= start_ + size_) {
+        out_.PutUnsigned(x.size());
+      } else {
+        ok_ = false;
+      }
+    }
+  }
+
+  template<typename A> void Put(const std::optional<A> &x) {
+    out_.PutUnsigned(x.has_value());
+    if (x) {
+      Put(*x);
+    }
+  }
+  template<typename A> void Put(const List<A> &x) {
+    out_.PutUnsigned(x.size());
+    for (const A &y : x) {
+      Put(y);
+    }
+  }
+  template<typename... As> void Put(const std::tuple<As...> &x) {
+    std::apply([&](const As &... y) { (Put(y), ...); }, x);
+  }
+  template<typename... As> void Put(const std::variant<As...> &x) {
+    out_.PutUnsigned(x.index());
+    std::visit([&](const auto &y) { Put(y); }, x);
+  }
+  template<typename A, bool COPY>
+  void Put(const common::Indirection<A, COPY> &x) {
+    Put(x.value());
+  }
+
+  template<typename A> void Put(const UnlabeledStatement<A> &x) {
+    Put(x.statement);
+    Put(x.source);
+  }
+  template<typename A> void Put(const Statement<A> &x) {
+    Put(x.label);
+    Put(x.statement);
+    Put(x.source);
+  }
+  template<typename VAR, typename BOUND>
+  void Put(const LoopBounds<VAR, BOUND> &x) {
+    Put(x.name);
+    Put(x.lower);
+    Put(x.upper);
+    Put(x.step);
+  }
+
+  void Put(const Name &x) { Put(x.source); }
+  void Put(const AcSpec &x) {
+    Put(x.type);
+    Put(x.values);
+  }
+  void Put(const ArrayElement &x) {
+    Put(x.base);
+    Put(x.subscripts);
+  }
+  void Put(const CharSelector::LengthAndKind &x) {
+    Put(x.length);
+    Put(x.kind);
+  }
+  void Put(const CaseValueRange::Range &x) {
+    Put(x.lower);
+    Put(x.upper);
+  }
+  void Put(const CoindexedNamedObject &x) {
+    Put(x.base);
+    Put(x.imageSelector);
+  }
+  void Put(const CommonStmt &x) { Put(x.blocks); }
+  void Put(const DeclarationTypeSpec::Class &x) { Put(x.derived); }
+  void Put(const DeclarationTypeSpec::Type &x) { Put(x.derived); }
+  void Put(const ImportStmt &x) {
+    Put(x.kind);
+    Put(x.names);
+  }
+  void Put(const IntrinsicTypeSpec::Character &x) { Put(x.selector); }
+  void Put(const IntrinsicTypeSpec::Complex &x) { Put(x.kind); }
+  void Put(const IntrinsicTypeSpec::Logical &x) { Put(x.kind); }
+  void Put(const IntrinsicTypeSpec::Real &x) { Put(x.kind); }
+  void Put(const PartRef &x) {
+    Put(x.name);
+    Put(x.subscripts);
+    Put(x.imageSelector);
+  }
+  void Put(const ReadStmt &x) {
+    Put(x.iounit);
+    Put(x.format);
+    Put(x.controls);
+    Put(x.items);
+  }
+  void Put(const RealLiteralConstant &x) {
+    Put(x.real);
+    Put(x.kind);
+  }
+  void Put(const RealLiteralConstant::Real &x) { Put(x.source); }
+  void Put(const StructureComponent &x) {
+    Put(x.base);
+    Put(x.component);
+  }
+  void Put(const Suffix &x) {
+    Put(x.binding);
+    Put(x.resultName);
+  }
+  void Put(const TypeBoundProcedureStmt::WithInterface &x) {
+    Put(x.interfaceName);
+    Put(x.attributes);
+    Put(x.bindingNames);
+  }
+  void Put(const TypeBoundProcedureStmt::WithoutInterface &x) {
+    Put(x.attributes);
+    Put(x.declarations);
+  }
+  void Put(const UseStmt &x) {
+    Put(x.nature);
+    Put(x.moduleName);
+    Put(x.u);
+  }
+  void Put(const WriteStmt &x) {
+    Put(x.iounit);
+    Put(x.format);
+    Put(x.controls);
+    Put(x.items);
+  }
+  void Put(const format::ControlEditDesc &x) {
+    Put(x.kind);
+    Put(x.count);
+  }
+  void Put(const format::DerivedTypeDataEditDesc &x) {
+    Put(x.type);
+    Put(x.parameters);
+  }
+  void Put(const format::FormatItem &x) {
+    Put(x.repeatCount);
+    Put(x.u);
+  }
+  void Put(const format::FormatSpecification &x) {
+    Put(x.items);
+    Put(x.unlimitedItems);
+  }
+  void Put(const format::IntrinsicTypeDataEditDesc &x) {
+    Put(x.kind);
+    Put(x.width);
+    Put(x.digits);
+    Put(x.exponentWidth);
+  }
+  void Put(const OmpLinearClause::WithModifier &x) {
+    Put(x.modifier);
+    Put(x.names);
+    Put(x.step);
+  }
+  void Put(const OmpLinearClause::WithoutModifier &x) {
+    Put(x.names);
+    Put(x.step);
+  }
+
+private:
+  BinaryEncoder &out_;
+  const char *start_;
+  std::size_t size_;
+  bool ok_{true};
+};
+
+class ParseTreeDecoder {
+public:
+  template<typename A> struct Tag {};
+
+  ParseTreeDecoder(BinaryDecoder &in, const CookedSource &cooked)
+    : in_{in}, start_{cooked.data().data()}, size_{cooked.data().size()} {}
+
+  template<typename A> A Get(Tag<A>) {
+    if constexpr (std::is_enum_v<A>) {
+      return static_cast<A>(in_.GetSigned());
+    } else if constexpr (std::is_integral_v<A> && std::is_signed_v<A>) {
+      return static_cast<A>(in_.GetSigned());
+    } else if constexpr (std::is_integral_v<A>) {
+      return static_cast<A>(in_.GetUnsigned());
+    } else if constexpr (EmptyTrait<A>) {
+      A x{};
+      GetSource(x);
+      return x;
+    } else if constexpr (WrapperTrait<A>) {
+      A x{Get(Tag<decltype(A::v)>{})};
+      GetSource(x);
+      return x;
+    } else if constexpr (TupleTrait<A>) {
+      return GetTupleClass<A>(Tag<decltype(A::t)>{});
+    } else if constexpr (UnionTrait<A>) {
+      A x{Get(Tag<decltype(A::u)>{})};
+      GetSource(x);
+      return x;
+    } else if constexpr (ConstraintTrait<A>) {
+      return A{Get(Tag<decltype(A::thing)>{})};
+    } else {
+      static_assert(IsLeaf<A>, "parse tree class cannot be decoded");
+    }
+  }
+
+  std::string Get(Tag<std::string>) { return std::string{in_.GetString()}; }
+  const char *Get(Tag<const char *>) {
+    std::uint64_t n{in_.GetUnsigned()};
+    CHECK(n <= size_ + 1);
+    return n == 0 ? nullptr : start_ + (n - 1);
+  }
+  CharBlock Get(Tag<CharBlock>) {
+    if (const char *at{Get(Tag<const char *>{})}) {
+      std::uint64_t n{in_.GetUnsigned()};
+      CHECK(n <= static_cast<std::uint64_t>(start_ + size_ - at));
+      return CharBlock{at, static_cast<std::size_t>(n)};
+    } else {
+      return CharBlock{};
+    }
+  }
+
+  template<typename A> std::optional<A> Get(Tag<std::optional<A>>) {
+    if (in_.GetUnsigned()) {
+      return std::optional<A>{Get(Tag<A>{})};
+    } else {
+      return std::nullopt;
+    }
+  }
+  template<typename A> List<A> Get(Tag<List<A>>) {
+    List<A> result;
+    for (std::uint64_t n{in_.GetUnsigned()}; n > 0; --n) {
+      result.emplace_back(Get(Tag<A>{}));
+    }
+    return result;
+  }
+  template<typename... As> std::tuple<As...> Get(Tag<std::tuple<As...>>) {
+    return std::tuple<As...>{Get(Tag<As>{})...};
+  }
+  template<typename... As> std::variant<As...> Get(Tag<std::variant<As...>>) {
+    return GetVariant<std::variant<As...>>(
+        std::index_sequence_for<As...>{});
+  }
+  template<typename A, bool COPY>
+  common::Indirection<A, COPY> Get(Tag<common::Indirection<A, COPY>>) {
+    return common::Indirection<A, COPY>{Get(Tag<A>{})};
+  }
+
+  template<typename A> UnlabeledStatement<A> Get(Tag<UnlabeledStatement<A>>) {
+    UnlabeledStatement<A> x{Get(Tag<A>{})};
+    x.source = Get(Tag<CharBlock>{});
+    return x;
+  }
+  template<typename A> Statement<A> Get(Tag<Statement<A>>) {
+    std::optional<long> label;
+    if (auto n{Get(Tag<std::optional<Label>>{})}) {
+      label = *n;
+    }
+    Statement<A> x{std::move(label), Get(Tag<A>{})};
+    x.source = Get(Tag<CharBlock>{});
+    return x;
+  }
+  template<typename VAR, typename BOUND>
+  LoopBounds<VAR, BOUND> Get(Tag<LoopBounds<VAR, BOUND>>) {
+    return LoopBounds<VAR, BOUND>{Get(Tag<VAR>{}), Get(Tag<BOUND>{}),
+        Get(Tag<BOUND>{}), Get(Tag<std::optional<BOUND>>{})};
+  }
+
+  Name Get(Tag<Name>) { return Name{Get(Tag<CharBlock>{})}; }
+  AcSpec Get(Tag<AcSpec>) {
+    return AcSpec{
+        Get(Tag<std::optional<TypeSpec>>{}), Get(Tag<List<AcValue>>{})};
+  }
+  ArrayElement Get(Tag<ArrayElement>) {
+    return ArrayElement{
+        Get(Tag<DataRef>{}), Get(Tag<List<SectionSubscript>>{})};
+  }
+  CharSelector::LengthAndKind Get(Tag<CharSelector::LengthAndKind>) {
+    return CharSelector::LengthAndKind{
+        Get(Tag<std::optional<TypeParamValue>>{}),
+        Get(Tag<ScalarIntConstantExpr>{})};
+  }
+  CaseValueRange::Range Get(Tag<CaseValueRange::Range>) {
+    return CaseValueRange::Range{Get(Tag<std::optional<CaseValue>>{}),
+        Get(Tag<std::optional<CaseValue>>{})};
+  }
+  CoindexedNamedObject Get(Tag<CoindexedNamedObject>) {
+    return CoindexedNamedObject{
+        Get(Tag<DataRef>{}), Get(Tag<ImageSelector>{})};
+  }
+  CommonStmt Get(Tag<CommonStmt>) {
+    // The constructor's arguments are the first block's members and
+    // the other blocks.
+    auto blocks{Get(Tag<List<CommonStmt::Block>>{})};
+    CHECK(!blocks.empty());
+    auto &first{blocks.front().t};
+    auto name{std::move(std::get<std::optional<Name>>(first))};
+    auto objects{std::move(std::get<List<CommonBlockObject>>(first))};
+    blocks.pop_front();
+    return CommonStmt{std::move(name), std::move(objects), std::move(blocks)};
+  }
+  DeclarationTypeSpec::Class Get(Tag<DeclarationTypeSpec::Class>) {
+    return DeclarationTypeSpec::Class{Get(Tag<DerivedTypeSpec>{})};
+  }
+  DeclarationTypeSpec::Type Get(Tag<DeclarationTypeSpec::Type>) {
+    return DeclarationTypeSpec::Type{Get(Tag<DerivedTypeSpec>{})};
+  }
+  ImportStmt Get(Tag<ImportStmt>) {
+    return ImportStmt{Get(Tag<common::ImportKind>{}), Get(Tag<List<Name>>{})};
+  }
+  IntrinsicTypeSpec::Character Get(Tag<IntrinsicTypeSpec::Character>) {
+    return IntrinsicTypeSpec::Character{
+        Get(Tag<std::optional<CharSelector>>{})};
+  }
+  IntrinsicTypeSpec::Complex Get(Tag<IntrinsicTypeSpec::Complex>) {
+    return IntrinsicTypeSpec::Complex{Get(Tag<std::optional<KindSelector>>{})};
+  }
+  IntrinsicTypeSpec::Logical Get(Tag<IntrinsicTypeSpec::Logical>) {
+    return IntrinsicTypeSpec::Logical{Get(Tag<std::optional<KindSelector>>{})};
+  }
+  IntrinsicTypeSpec::Real Get(Tag<IntrinsicTypeSpec::Real>) {
+    return IntrinsicTypeSpec::Real{Get(Tag<std::optional<KindSelector>>{})};
+  }
+  PartRef Get(Tag<PartRef>) {
+    return PartRef{Get(Tag<Name>{}), Get(Tag<List<SectionSubscript>>{}),
+        Get(Tag<std::optional<ImageSelector>>{})};
+  }
+  ReadStmt Get(Tag<ReadStmt>) {
+    return ReadStmt{Get(Tag<std::optional<IoUnit>>{}),
+        Get(Tag<std::optional<Format>>{}), Get(Tag<List<IoControlSpec>>{}),
+        Get(Tag<List<InputItem>>{})};
+  }
+  RealLiteralConstant Get(Tag<RealLiteralConstant>) {
+    return RealLiteralConstant{Get(Tag<RealLiteralConstant::Real>{}),
+        Get(Tag<std::optional<KindParam>>{})};
+  }
+  RealLiteralConstant::Real Get(Tag<RealLiteralConstant::Real>) {
+    RealLiteralConstant::Real x;
+    x.source = Get(Tag<CharBlock>{});
+    return x;
+  }
+  StructureComponent Get(Tag<StructureComponent>) {
+    return StructureComponent{Get(Tag<DataRef>{}), Get(Tag<Name>{})};
+  }
+  Suffix Get(Tag<Suffix>) {
+    auto binding{Get(Tag<std::optional<LanguageBindingSpec>>{})};
+    auto resultName{Get(Tag<std::optional<Name>>{})};
+    if (binding) {
+      return Suffix{std::move(*binding), std::move(resultName)};
+    } else {
+      CHECK(resultName);
+      return Suffix{std::move(*resultName), std::move(binding)};
+    }
+  }
+  TypeBoundProcedureStmt::WithInterface Get(
+      Tag<TypeBoundProcedureStmt::WithInterface>) {
+    return TypeBoundProcedureStmt::WithInterface{Get(Tag<Name>{}),
+        Get(Tag<List<BindAttr>>{}), Get(Tag<List<Name>>{})};
+  }
+  TypeBoundProcedureStmt::WithoutInterface Get(
+      Tag<TypeBoundProcedureStmt::WithoutInterface>) {
+    return TypeBoundProcedureStmt::WithoutInterface{
+        Get(Tag<List<BindAttr>>{}), Get(Tag<List<TypeBoundProcDecl>>{})};
+  }
+  UseStmt Get(Tag<UseStmt>) {
+    auto nature{Get(Tag<std::optional<UseStmt::ModuleNature>>{})};
+    auto moduleName{Get(Tag<Name>{})};
+    return std::visit(
+        [&](auto &&list) {
+          return UseStmt{
+              std::move(nature), std::move(moduleName), std::move(list)};
+        },
+        Get(Tag<decltype(UseStmt::u)>{}));
+  }
+  WriteStmt Get(Tag<WriteStmt>) {
+    return WriteStmt{Get(Tag<std::optional<IoUnit>>{}),
+        Get(Tag<std::optional<Format>>{}), Get(Tag<List<IoControlSpec>>{}),
+        Get(Tag<List<OutputItem>>{})};
+  }
+  format::ControlEditDesc Get(Tag<format::ControlEditDesc>) {
+    return format::ControlEditDesc{
+        Get(Tag<format::ControlEditDesc::Kind>{}), Get(Tag<std::int64_t>{})};
+  }
+  format::DerivedTypeDataEditDesc Get(Tag<format::DerivedTypeDataEditDesc>) {
+    return format::DerivedTypeDataEditDesc{
+        Get(Tag<std::string>{}), Get(Tag<List<std::int64_t>>{})};
+  }
+  format::FormatItem Get(Tag<format::FormatItem>) {
+    return format::FormatItem{Get(Tag<std::optional<std::uint64_t>>{}),
+        Get(Tag<decltype(format::FormatItem::u)>{})};
+  }
+  format::FormatSpecification Get(Tag<format::FormatSpecification>) {
+    return format::FormatSpecification{
+        Get(Tag<List<format::FormatItem>>{}),
+        Get(Tag<List<format::FormatItem>>{})};
+  }
+  format::IntrinsicTypeDataEditDesc Get(
+      Tag<format::IntrinsicTypeDataEditDesc>) {
+    return format::IntrinsicTypeDataEditDesc{
+        Get(Tag<format::IntrinsicTypeDataEditDesc::Kind>{}),
+        Get(Tag<std::optional<int>>{}), Get(Tag<std::optional<int>>{}),
+        Get(Tag<std::optional<int>>{})};
+  }
+  OmpLinearClause::WithModifier Get(Tag<OmpLinearClause::WithModifier>) {
+    return OmpLinearClause::WithModifier{Get(Tag<OmpLinearModifier>{}),
+        Get(Tag<List<Name>>{}),
+        Get(Tag<std::optional<ScalarIntConstantExpr>>{})};
+  }
+  OmpLinearClause::WithoutModifier Get(Tag<OmpLinearClause::WithoutModifier>) {
+    return OmpLinearClause::WithoutModifier{Get(Tag<List<Name>>{}),
+        Get(Tag<std::optional<ScalarIntConstantExpr>>{})};
+  }
+
+private:
+  template<typename A> void GetSource(A &x) {
+    if constexpr (HasSource<A>) {
+      x.source = Get(Tag<CharBlock>{});
+    }
+  }
+  template<typename A, typename... As>
+  A GetTupleClass(Tag<std::tuple<As...>>) {
+    A x{Get(Tag<As>{})...};
+    GetSource(x);
+    return x;
+  }
+  template<typename V, std::size_t J> static V GetAlternative(
+      ParseTreeDecoder &decoder) {
+    return V{std::in_place_index<J>,
+        decoder.Get(Tag<std::variant_alternative_t<J, V>>{})};
+  }
+  template<typename V, std::size_t... J>
+  V GetVariant(std::index_sequence<J...>) {
+    static constexpr V (*getters[])(ParseTreeDecoder &){
+        &GetAlternative<V, J>...};
+    std::uint64_t index{in_.GetUnsigned()};
+    CHECK(index < sizeof...(J));
+    return getters[index](*this);
+  }
+
+  BinaryDecoder &in_;
+  const char *start_;
+  std::size_t size_;
+};
+
+bool EncodeParseTree(
+    BinaryEncoder &out, const Program &program, const CookedSource &cooked) {
+  ParseTreeEncoder encoder{out, cooked};
+  encoder.Put(program);
+  return encoder.ok();
+}
+
+Program DecodeParseTree(BinaryDecoder &in, const CookedSource &cooked) {
+  ParseTreeDecoder decoder{in, cooked};
+  return decoder.Get(ParseTreeDecoder::Tag<Program>{});
+}
+}
@@ -0,0 +1,68 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FORTRAN_PARSER_BINARY_PARSE_TREE_H_
+#define FORTRAN_PARSER_BINARY_PARSE_TREE_H_
+
+// A compact binary encoding of parse trees, with which Parsing saves the
+// parse tree of a source file so that a later compilation can load it
+// in place of prescanning and parsing the file again (see
+// Parsing::SaveParseTree()).  CharBlocks and other locations in the cooked
+// character stream are encoded as offsets into it, so that a tree can be
+// decoded onto a copy of the stream at another address.  The results of
+// semantic analysis that the tree may hold, e.g. Name::symbol, are not
+// encoded.  Integers are encoded in as few bytes as possible (LEB128).
+
+#include "parse-tree.h"
+#include "provenance.h"
+#include <cinttypes>
+#include <string>
+#include <string_view>
+
+namespace Fortran::parser {
+
+class BinaryEncoder {
+public:
+  std::string &bytes() { return bytes_; }
+  void PutUnsigned(std::uint64_t);
+  void PutSigned(std::int64_t);
+  void PutString(std::string_view);
+
+private:
+  std::string bytes_;
+};
+
+// Reads back what a BinaryEncoder wrote.  The data are expected to be
+// intact (Parsing::LoadParseTree() verifies a fingerprint of them first),
+// so an attempt to read past their end is fatal.
+class BinaryDecoder {
+public:
+  BinaryDecoder(const char *start, const char *limit)
+    : at_{start}, limit_{limit} {}
+  bool IsAtEnd() const { return at_ == limit_; }
+  std::uint64_t GetUnsigned();
+  std::int64_t GetSigned();
+  std::string_view GetString();
+
+private:
+  const char *at_, *limit_;
+};
+
+// Returns false when a location in the tree does not lie in the cooked
+// character stream, so that the tree cannot be saved.
+bool EncodeParseTree(BinaryEncoder &, const Program &, const CookedSource &);
+// The nodes of the tree are allocated in the current Arena, if any.
+Program DecodeParseTree(BinaryDecoder &, const CookedSource &);
+}
+#endif  // FORTRAN_PARSER_BINARY_PARSE_TREE_H_
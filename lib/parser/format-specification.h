@@ -24,8 +24,8 @@
 // dependences on other parts of the compiler's source code.
 // TODO: support Q formatting extension?
 
+#include "list.h"
 #include <cinttypes>
-#include <list>
 #include <optional>
 #include <string>
 #include <variant>
@@ -62,10 +62,10 @@ struct DerivedTypeDataEditDesc {
   DerivedTypeDataEditDesc() = delete;
   DerivedTypeDataEditDesc(DerivedTypeDataEditDesc &&) = default;
   DerivedTypeDataEditDesc &operator=(DerivedTypeDataEditDesc &&) = default;
-  DerivedTypeDataEditDesc(std::string &&t, std::list<std::int64_t> &&p)
+  DerivedTypeDataEditDesc(std::string &&t, parser::List<std::int64_t> &&p)
     : type{std::move(t)}, parameters{std::move(p)} {}
   std::string type;
-  std::list<std::int64_t> parameters;
+  parser::List<std::int64_t> parameters;
 };
 
 // R1313 control-edit-desc ->
@@ -129,7 +129,7 @@ struct FormatItem {
   explicit FormatItem(A &&x) : u{std::move(x)} {}
   std::optional<std::uint64_t> repeatCount;
   std::variant<IntrinsicTypeDataEditDesc, DerivedTypeDataEditDesc,
-      ControlEditDesc, std::string, std::list<FormatItem>>
+      ControlEditDesc, std::string, parser::List<FormatItem>>
       u;
 };
 
@@ -141,11 +141,12 @@ struct FormatSpecification {
   FormatSpecification() = delete;
   FormatSpecification(FormatSpecification &&) = default;
   FormatSpecification &operator=(FormatSpecification &&) = default;
-  explicit FormatSpecification(std::list<FormatItem> &&is)
+  explicit FormatSpecification(parser::List<FormatItem> &&is)
     : items(std::move(is)) {}
-  FormatSpecification(std::list<FormatItem> &&is, std::list<FormatItem> &&us)
+  FormatSpecification(
+      parser::List<FormatItem> &&is, parser::List<FormatItem> &&us)
     : items(std::move(is)), unlimitedItems(std::move(us)) {}
-  std::list<FormatItem> items, unlimitedItems;
+  parser::List<FormatItem> items, unlimitedItems;
 };
 }
 #endif  // FORTRAN_PARSER_FORMAT_SPECIFICATION_H_
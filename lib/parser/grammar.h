@@ -24,6 +24,8 @@
 #include "basic-parsers.h"
 #include "characters.h"
 #include "debug-parser.h"
+#include "keyword-dispatch.h"
+#include "memoized-parser.h"
 #include "parse-tree.h"
 #include "stmt-parser.h"
 #include "token-parsers.h"
@@ -32,7 +34,6 @@
 #include <cinttypes>
 #include <cstdio>
 #include <functional>
-#include <list>
 #include <optional>
 #include <string>
 #include <tuple>
@@ -57,7 +58,7 @@ namespace Fortran::parser {
 // are allowed, and so we have a variant production for declaration-construct
 // that implements those constraints.
 constexpr auto execPartLookAhead{
-    first(actionStmt >> ok, ompEndLoopDirective >> ok, openmpConstruct >> ok,
+    first(memoized(actionStmt) >> ok, ompEndLoopDirective >> ok, openmpConstruct >> ok,
         "ASSOCIATE ("_tok, "BLOCK"_tok, "SELECT"_tok, "CHANGE TEAM"_sptok,
         "CRITICAL"_tok, "DO"_tok, "IF ("_tok, "WHERE ("_tok, "FORALL ("_tok)};
 constexpr auto declErrorRecovery{
@@ -101,28 +102,50 @@ constexpr auto limitedDeclarationConstruct{recovery(
     construct<DeclarationConstruct>(
         stmtErrorRecoveryStart >> skipStmtErrorRecovery))};
 
+// The keywords that can begin an other-specification-stmt
+constexpr char otherSpecificationKeywords[]{
+    "public|private|allocatable|asynchronous|bind|codimension|contiguous|"
+    "dimension|external|intent|intrinsic|namelist|optional|pointer|protected|"
+    "save|target|value|volatile|common|equivalence"};
+
 // R508 specification-construct ->
 //        derived-type-def | enum-def | generic-stmt | interface-block |
 //        parameter-stmt | procedure-declaration-stmt |
 //        other-specification-stmt | type-declaration-stmt
 TYPE_CONTEXT_PARSER("specification construct"_en_US,
-    first(construct<SpecificationConstruct>(indirect(Parser<DerivedTypeDef>{})),
-        construct<SpecificationConstruct>(indirect(Parser<EnumDef>{})),
-        construct<SpecificationConstruct>(
-            statement(indirect(Parser<GenericStmt>{}))),
-        construct<SpecificationConstruct>(indirect(interfaceBlock)),
-        construct<SpecificationConstruct>(statement(indirect(parameterStmt))),
-        construct<SpecificationConstruct>(
-            statement(indirect(oldParameterStmt))),
-        construct<SpecificationConstruct>(
-            statement(indirect(Parser<ProcedureDeclarationStmt>{}))),
-        construct<SpecificationConstruct>(
-            statement(Parser<OtherSpecificationStmt>{})),
+    dispatchOnKeyword(
+        leadingKeyword("type",
+            construct<SpecificationConstruct>(
+                indirect(Parser<DerivedTypeDef>{}))),
+        leadingKeyword("enum",
+            construct<SpecificationConstruct>(indirect(Parser<EnumDef>{}))),
+        leadingKeyword("generic",
+            construct<SpecificationConstruct>(
+                statement(indirect(Parser<GenericStmt>{})))),
+        leadingKeyword("interface|abstractinterface",
+            construct<SpecificationConstruct>(indirect(interfaceBlock))),
+        leadingKeyword("parameter",
+            construct<SpecificationConstruct>(
+                statement(indirect(parameterStmt)))),
+        leadingKeyword("parameter",
+            construct<SpecificationConstruct>(
+                statement(indirect(oldParameterStmt)))),
+        leadingKeyword("procedure",
+            construct<SpecificationConstruct>(
+                statement(indirect(Parser<ProcedureDeclarationStmt>{})))),
+        leadingKeyword(otherSpecificationKeywords,
+            construct<SpecificationConstruct>(
+                statement(Parser<OtherSpecificationStmt>{}))),
         construct<SpecificationConstruct>(
             statement(indirect(typeDeclarationStmt))),
-        construct<SpecificationConstruct>(indirect(Parser<StructureDef>{})),
-        construct<SpecificationConstruct>(indirect(openmpDeclarativeConstruct)),
-        construct<SpecificationConstruct>(indirect(compilerDirective))))
+        leadingKeyword("structure",
+            construct<SpecificationConstruct>(
+                indirect(Parser<StructureDef>{}))),
+        leadingKeyword("!",
+            construct<SpecificationConstruct>(
+                indirect(openmpDeclarativeConstruct))),
+        leadingKeyword("!",
+            construct<SpecificationConstruct>(indirect(compilerDirective)))))
 
 // R513 other-specification-stmt ->
 //        access-stmt | allocatable-stmt | asynchronous-stmt | bind-stmt |
@@ -130,28 +153,51 @@ TYPE_CONTEXT_PARSER("specification construct"_en_US,
 //        intent-stmt | intrinsic-stmt | namelist-stmt | optional-stmt |
 //        pointer-stmt | protected-stmt | save-stmt | target-stmt |
 //        volatile-stmt | value-stmt | common-stmt | equivalence-stmt
-TYPE_PARSER(first(
-    construct<OtherSpecificationStmt>(indirect(Parser<AccessStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<AllocatableStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<AsynchronousStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<BindStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<CodimensionStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<ContiguousStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<DimensionStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<ExternalStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<IntentStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<IntrinsicStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<NamelistStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<OptionalStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<PointerStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<ProtectedStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<SaveStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<TargetStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<ValueStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<VolatileStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<CommonStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<EquivalenceStmt>{})),
-    construct<OtherSpecificationStmt>(indirect(Parser<BasedPointerStmt>{}))))
+TYPE_PARSER(dispatchOnKeyword(
+    leadingKeyword("public|private",
+        construct<OtherSpecificationStmt>(indirect(Parser<AccessStmt>{}))),
+    leadingKeyword("allocatable",
+        construct<OtherSpecificationStmt>(indirect(Parser<AllocatableStmt>{}))),
+    leadingKeyword("asynchronous",
+        construct<OtherSpecificationStmt>(
+            indirect(Parser<AsynchronousStmt>{}))),
+    leadingKeyword("bind",
+        construct<OtherSpecificationStmt>(indirect(Parser<BindStmt>{}))),
+    leadingKeyword("codimension",
+        construct<OtherSpecificationStmt>(indirect(Parser<CodimensionStmt>{}))),
+    leadingKeyword("contiguous",
+        construct<OtherSpecificationStmt>(indirect(Parser<ContiguousStmt>{}))),
+    leadingKeyword("dimension",
+        construct<OtherSpecificationStmt>(indirect(Parser<DimensionStmt>{}))),
+    leadingKeyword("external",
+        construct<OtherSpecificationStmt>(indirect(Parser<ExternalStmt>{}))),
+    leadingKeyword("intent",
+        construct<OtherSpecificationStmt>(indirect(Parser<IntentStmt>{}))),
+    leadingKeyword("intrinsic",
+        construct<OtherSpecificationStmt>(indirect(Parser<IntrinsicStmt>{}))),
+    leadingKeyword("namelist",
+        construct<OtherSpecificationStmt>(indirect(Parser<NamelistStmt>{}))),
+    leadingKeyword("optional",
+        construct<OtherSpecificationStmt>(indirect(Parser<OptionalStmt>{}))),
+    leadingKeyword("pointer",
+        construct<OtherSpecificationStmt>(indirect(Parser<PointerStmt>{}))),
+    leadingKeyword("protected",
+        construct<OtherSpecificationStmt>(indirect(Parser<ProtectedStmt>{}))),
+    leadingKeyword("save",
+        construct<OtherSpecificationStmt>(indirect(Parser<SaveStmt>{}))),
+    leadingKeyword("target",
+        construct<OtherSpecificationStmt>(indirect(Parser<TargetStmt>{}))),
+    leadingKeyword("value",
+        construct<OtherSpecificationStmt>(indirect(Parser<ValueStmt>{}))),
+    leadingKeyword("volatile",
+        construct<OtherSpecificationStmt>(indirect(Parser<VolatileStmt>{}))),
+    leadingKeyword("common",
+        construct<OtherSpecificationStmt>(indirect(Parser<CommonStmt>{}))),
+    leadingKeyword("equivalence",
+        construct<OtherSpecificationStmt>(indirect(Parser<EquivalenceStmt>{}))),
+    leadingKeyword("pointer",
+        construct<OtherSpecificationStmt>(
+            indirect(Parser<BasedPointerStmt>{})))))
 
 // R604 constant ->  literal-constant | named-constant
 // Used only via R607 int-constant and R845 data-stmt-constant.
@@ -364,47 +410,77 @@ TYPE_CONTEXT_PARSER("internal subprogram part"_en_US,
 //        wait-stmt | where-stmt | write-stmt | computed-goto-stmt | forall-stmt
 // R1159 continue-stmt -> CONTINUE
 // R1163 fail-image-stmt -> FAIL IMAGE
-TYPE_PARSER(first(construct<ActionStmt>(indirect(Parser<AllocateStmt>{})),
+TYPE_PARSER(dispatchOnKeyword(
+    leadingKeyword(
+        "allocate", construct<ActionStmt>(indirect(Parser<AllocateStmt>{}))),
     construct<ActionStmt>(indirect(assignmentStmt)),
     construct<ActionStmt>(indirect(pointerAssignmentStmt)),
-    construct<ActionStmt>(indirect(Parser<BackspaceStmt>{})),
-    construct<ActionStmt>(indirect(Parser<CallStmt>{})),
-    construct<ActionStmt>(indirect(Parser<CloseStmt>{})),
-    construct<ActionStmt>(construct<ContinueStmt>("CONTINUE"_tok)),
-    construct<ActionStmt>(indirect(Parser<CycleStmt>{})),
-    construct<ActionStmt>(indirect(Parser<DeallocateStmt>{})),
-    construct<ActionStmt>(indirect(Parser<EndfileStmt>{})),
-    construct<ActionStmt>(indirect(Parser<EventPostStmt>{})),
-    construct<ActionStmt>(indirect(Parser<EventWaitStmt>{})),
-    construct<ActionStmt>(indirect(Parser<ExitStmt>{})),
-    construct<ActionStmt>(construct<FailImageStmt>("FAIL IMAGE"_sptok)),
-    construct<ActionStmt>(indirect(Parser<FlushStmt>{})),
-    construct<ActionStmt>(indirect(Parser<FormTeamStmt>{})),
-    construct<ActionStmt>(indirect(Parser<GotoStmt>{})),
-    construct<ActionStmt>(indirect(Parser<IfStmt>{})),
-    construct<ActionStmt>(indirect(Parser<InquireStmt>{})),
-    construct<ActionStmt>(indirect(Parser<LockStmt>{})),
-    construct<ActionStmt>(indirect(Parser<NullifyStmt>{})),
-    construct<ActionStmt>(indirect(Parser<OpenStmt>{})),
-    construct<ActionStmt>(indirect(Parser<PrintStmt>{})),
-    construct<ActionStmt>(indirect(Parser<ReadStmt>{})),
-    construct<ActionStmt>(indirect(Parser<ReturnStmt>{})),
-    construct<ActionStmt>(indirect(Parser<RewindStmt>{})),
-    construct<ActionStmt>(indirect(Parser<StopStmt>{})),  // & error-stop-stmt
-    construct<ActionStmt>(indirect(Parser<SyncAllStmt>{})),
-    construct<ActionStmt>(indirect(Parser<SyncImagesStmt>{})),
-    construct<ActionStmt>(indirect(Parser<SyncMemoryStmt>{})),
-    construct<ActionStmt>(indirect(Parser<SyncTeamStmt>{})),
-    construct<ActionStmt>(indirect(Parser<UnlockStmt>{})),
-    construct<ActionStmt>(indirect(Parser<WaitStmt>{})),
-    construct<ActionStmt>(indirect(whereStmt)),
-    construct<ActionStmt>(indirect(Parser<WriteStmt>{})),
-    construct<ActionStmt>(indirect(Parser<ComputedGotoStmt>{})),
-    construct<ActionStmt>(indirect(forallStmt)),
-    construct<ActionStmt>(indirect(Parser<ArithmeticIfStmt>{})),
-    construct<ActionStmt>(indirect(Parser<AssignStmt>{})),
-    construct<ActionStmt>(indirect(Parser<AssignedGotoStmt>{})),
-    construct<ActionStmt>(indirect(Parser<PauseStmt>{}))))
+    leadingKeyword(
+        "backspace", construct<ActionStmt>(indirect(Parser<BackspaceStmt>{}))),
+    leadingKeyword("call", construct<ActionStmt>(indirect(Parser<CallStmt>{}))),
+    leadingKeyword(
+        "close", construct<ActionStmt>(indirect(Parser<CloseStmt>{}))),
+    leadingKeyword("continue",
+        construct<ActionStmt>(construct<ContinueStmt>("CONTINUE"_tok))),
+    leadingKeyword(
+        "cycle", construct<ActionStmt>(indirect(Parser<CycleStmt>{}))),
+    leadingKeyword("deallocate",
+        construct<ActionStmt>(indirect(Parser<DeallocateStmt>{}))),
+    leadingKeyword(
+        "endfile", construct<ActionStmt>(indirect(Parser<EndfileStmt>{}))),
+    leadingKeyword(
+        "eventpost", construct<ActionStmt>(indirect(Parser<EventPostStmt>{}))),
+    leadingKeyword(
+        "eventwait", construct<ActionStmt>(indirect(Parser<EventWaitStmt>{}))),
+    leadingKeyword("exit", construct<ActionStmt>(indirect(Parser<ExitStmt>{}))),
+    leadingKeyword("failimage",
+        construct<ActionStmt>(construct<FailImageStmt>("FAIL IMAGE"_sptok))),
+    leadingKeyword(
+        "flush", construct<ActionStmt>(indirect(Parser<FlushStmt>{}))),
+    leadingKeyword(
+        "formteam", construct<ActionStmt>(indirect(Parser<FormTeamStmt>{}))),
+    leadingKeyword("goto", construct<ActionStmt>(indirect(Parser<GotoStmt>{}))),
+    leadingKeyword("if", construct<ActionStmt>(indirect(Parser<IfStmt>{}))),
+    leadingKeyword(
+        "inquire", construct<ActionStmt>(indirect(Parser<InquireStmt>{}))),
+    leadingKeyword("lock", construct<ActionStmt>(indirect(Parser<LockStmt>{}))),
+    leadingKeyword(
+        "nullify", construct<ActionStmt>(indirect(Parser<NullifyStmt>{}))),
+    leadingKeyword("open", construct<ActionStmt>(indirect(Parser<OpenStmt>{}))),
+    leadingKeyword(
+        "print", construct<ActionStmt>(indirect(Parser<PrintStmt>{}))),
+    leadingKeyword("read", construct<ActionStmt>(indirect(Parser<ReadStmt>{}))),
+    leadingKeyword(
+        "return", construct<ActionStmt>(indirect(Parser<ReturnStmt>{}))),
+    leadingKeyword(
+        "rewind", construct<ActionStmt>(indirect(Parser<RewindStmt>{}))),
+    leadingKeyword("stop|errorstop",
+        construct<ActionStmt>(indirect(Parser<StopStmt>{}))),
+    leadingKeyword(
+        "syncall", construct<ActionStmt>(indirect(Parser<SyncAllStmt>{}))),
+    leadingKeyword("syncimages",
+        construct<ActionStmt>(indirect(Parser<SyncImagesStmt>{}))),
+    leadingKeyword("syncmemory",
+        construct<ActionStmt>(indirect(Parser<SyncMemoryStmt>{}))),
+    leadingKeyword(
+        "syncteam", construct<ActionStmt>(indirect(Parser<SyncTeamStmt>{}))),
+    leadingKeyword(
+        "unlock", construct<ActionStmt>(indirect(Parser<UnlockStmt>{}))),
+    leadingKeyword("wait", construct<ActionStmt>(indirect(Parser<WaitStmt>{}))),
+    leadingKeyword("where", construct<ActionStmt>(indirect(whereStmt))),
+    leadingKeyword(
+        "write", construct<ActionStmt>(indirect(Parser<WriteStmt>{}))),
+    leadingKeyword("goto",
+        construct<ActionStmt>(indirect(Parser<ComputedGotoStmt>{}))),
+    leadingKeyword("forall", construct<ActionStmt>(indirect(forallStmt))),
+    leadingKeyword("if",
+        construct<ActionStmt>(indirect(Parser<ArithmeticIfStmt>{}))),
+    leadingKeyword(
+        "assign", construct<ActionStmt>(indirect(Parser<AssignStmt>{}))),
+    leadingKeyword("goto",
+        construct<ActionStmt>(indirect(Parser<AssignedGotoStmt>{}))),
+    leadingKeyword(
+        "pause", construct<ActionStmt>(indirect(Parser<PauseStmt>{})))))
 
 // Fortran allows the statement with the corresponding label at the end of
 // a do-construct that begins with an old-style label-do-stmt to be a
@@ -418,26 +494,44 @@ TYPE_PARSER(first(construct<ActionStmt>(indirect(Parser<AllocateStmt>{})),
 //        case-construct | change-team-construct | critical-construct |
 //        do-construct | if-construct | select-rank-construct |
 //        select-type-construct | where-construct | forall-construct
-constexpr auto executableConstruct{
-    first(construct<ExecutableConstruct>(CapturedLabelDoStmt{}),
-        construct<ExecutableConstruct>(EndDoStmtForCapturedLabelDoStmt{}),
-        construct<ExecutableConstruct>(indirect(Parser<DoConstruct>{})),
-        // Attempt DO statements before assignment statements for better
-        // error messages in cases like "DO10I=1,(error)".
-        construct<ExecutableConstruct>(statement(actionStmt)),
-        construct<ExecutableConstruct>(indirect(Parser<AssociateConstruct>{})),
-        construct<ExecutableConstruct>(indirect(Parser<BlockConstruct>{})),
-        construct<ExecutableConstruct>(indirect(Parser<CaseConstruct>{})),
-        construct<ExecutableConstruct>(indirect(Parser<ChangeTeamConstruct>{})),
-        construct<ExecutableConstruct>(indirect(Parser<CriticalConstruct>{})),
-        construct<ExecutableConstruct>(indirect(Parser<IfConstruct>{})),
-        construct<ExecutableConstruct>(indirect(Parser<SelectRankConstruct>{})),
-        construct<ExecutableConstruct>(indirect(Parser<SelectTypeConstruct>{})),
-        construct<ExecutableConstruct>(indirect(whereConstruct)),
-        construct<ExecutableConstruct>(indirect(forallConstruct)),
-        construct<ExecutableConstruct>(indirect(ompEndLoopDirective)),
-        construct<ExecutableConstruct>(indirect(openmpConstruct)),
-        construct<ExecutableConstruct>(indirect(compilerDirective)))};
+constexpr auto executableConstruct{dispatchOnKeyword(
+    leadingKeyword("do", construct<ExecutableConstruct>(CapturedLabelDoStmt{})),
+    leadingKeyword("enddo",
+        construct<ExecutableConstruct>(EndDoStmtForCapturedLabelDoStmt{})),
+    leadingKeyword(
+        "do", construct<ExecutableConstruct>(indirect(Parser<DoConstruct>{}))),
+    // Attempt DO statements before assignment statements for better
+    // error messages in cases like "DO10I=1,(error)".
+    construct<ExecutableConstruct>(statement(memoized(actionStmt))),
+    leadingKeyword("associate",
+        construct<ExecutableConstruct>(indirect(Parser<AssociateConstruct>{}))),
+    leadingKeyword("block",
+        construct<ExecutableConstruct>(indirect(Parser<BlockConstruct>{}))),
+    leadingKeyword("selectcase",
+        construct<ExecutableConstruct>(indirect(Parser<CaseConstruct>{}))),
+    leadingKeyword("changeteam",
+        construct<ExecutableConstruct>(
+            indirect(Parser<ChangeTeamConstruct>{}))),
+    leadingKeyword("critical",
+        construct<ExecutableConstruct>(indirect(Parser<CriticalConstruct>{}))),
+    leadingKeyword(
+        "if", construct<ExecutableConstruct>(indirect(Parser<IfConstruct>{}))),
+    leadingKeyword("selectrank",
+        construct<ExecutableConstruct>(
+            indirect(Parser<SelectRankConstruct>{}))),
+    leadingKeyword("selecttype",
+        construct<ExecutableConstruct>(
+            indirect(Parser<SelectTypeConstruct>{}))),
+    leadingKeyword(
+        "where", construct<ExecutableConstruct>(indirect(whereConstruct))),
+    leadingKeyword(
+        "forall", construct<ExecutableConstruct>(indirect(forallConstruct))),
+    leadingKeyword(
+        "!", construct<ExecutableConstruct>(indirect(ompEndLoopDirective))),
+    leadingKeyword(
+        "!", construct<ExecutableConstruct>(indirect(openmpConstruct))),
+    leadingKeyword(
+        "!", construct<ExecutableConstruct>(indirect(compilerDirective))))};
 
 // R510 execution-part-construct ->
 //        executable-construct | format-stmt | entry-stmt | data-stmt
@@ -906,7 +1000,7 @@ TYPE_PARSER((construct<StructureConstructor>(derivedTypeSpec,
                 // derived-type-spec.
                 construct<StructureConstructor>(
                     construct<DerivedTypeSpec>(
-                        name, construct<std::list<TypeParamSpec>>()),
+                        name, construct<List<TypeParamSpec>>()),
                     parenthesized(optionalList(Parser<ComponentSpec>{})))) /
     !"("_tok)
 
@@ -1008,7 +1102,7 @@ TYPE_PARSER(
         nonemptyList("expected entity declarations"_err_en_US, entityDecl)) ||
     // C806: no initializers allowed without colons ("REALA=1" is ambiguous)
     construct<TypeDeclarationStmt>(declarationTypeSpec,
-        construct<std::list<AttrSpec>>(),
+        construct<List<AttrSpec>>(),
         nonemptyList("expected entity declarations"_err_en_US,
             entityDeclWithoutEqInit)) ||
     // PGI-only extension: comma in place of doubled colons
@@ -1076,7 +1170,7 @@ TYPE_PARSER(
 
 // R810 deferred-coshape-spec -> :
 // deferred-coshape-spec-list - just a list of colons
-inline int listLength(std::list<Success> &&xs) { return xs.size(); }
+inline int listLength(List<Success> &&xs) { return xs.size(); }
 
 TYPE_PARSER(construct<DeferredCoshapeSpecList>(
     applyFunction(listLength, nonemptyList(":"_tok))))
@@ -2559,7 +2653,7 @@ TYPE_CONTEXT_PARSER("READ statement"_en_US,
             parenthesized(nonemptyList(ioControlSpec)), inputItemList) ||
         construct<ReadStmt>("READ" >> construct<std::optional<IoUnit>>(),
             construct<std::optional<Format>>(format),
-            construct<std::list<IoControlSpec>>(), many("," >> inputItem)))
+            construct<List<IoControlSpec>>(), many("," >> inputItem)))
 
 // R1214 id-variable -> scalar-int-variable
 constexpr auto idVariable{construct<IdVariable>(scalarIntVariable)};
@@ -2690,8 +2784,8 @@ TYPE_PARSER(first(construct<WaitSpec>(maybe("UNIT ="_tok) >> fileUnitNumber),
     construct<WaitSpec>("IOMSG =" >> msgVariable),
     construct<WaitSpec>("IOSTAT =" >> statVariable)))
 
-template<typename A> common::IfNoLvalue<std::list<A>, A> singletonList(A &&x) {
-  std::list<A> result;
+template<typename A> common::IfNoLvalue<List<A>, A> singletonList(A &&x) {
+  List<A> result;
   result.push_front(std::move(x));
   return result;
 }
@@ -3363,7 +3457,7 @@ TYPE_CONTEXT_PARSER("FUNCTION statement"_en_US,
         extension<LanguageFeature::OmitFunctionDummies>(
             construct<FunctionStmt>(  // PGI & Intel accept "FUNCTION F"
                 many(prefixSpec), "FUNCTION" >> name,
-                construct<std::list<Name>>(),
+                construct<List<Name>>(),
                 construct<std::optional<Suffix>>())))
 
 // R1532 suffix ->
@@ -3425,7 +3519,7 @@ TYPE_CONTEXT_PARSER("END PROCEDURE statement"_en_US,
 TYPE_PARSER(
     "ENTRY" >> (construct<EntryStmt>(name,
                     parenthesized(optionalList(dummyArg)), maybe(suffix)) ||
-                   construct<EntryStmt>(name, construct<std::list<DummyArg>>(),
+                   construct<EntryStmt>(name, construct<List<DummyArg>>(),
                        construct<std::optional<Suffix>>())))
 
 // R1542 return-stmt -> RETURN [scalar-int-expr]
@@ -15,8 +15,11 @@
 #include "instrumented-parser.h"
 #include "message.h"
 #include "provenance.h"
+#include <algorithm>
+#include <iomanip>
 #include <map>
 #include <ostream>
+#include <vector>
 
 namespace Fortran::parser {
 
@@ -80,4 +83,67 @@ void ParsingLog::Dump(std::ostream &o, const CookedSource &cooked) const {
     }
   }
 }
+
+ParserProfile::Entry &ParserProfile::Start(const MessageFixedText &tag) {
+  Entry &entry{entries_[tag.text().begin()]};
+  entry.tag = tag.text();
+  ++entry.calls;
+  ++entry.active;
+  return entry;
+}
+
+void ParserProfile::Finish(Entry &entry, const char *at, bool pass,
+    const ParseState &state, Clock::time_point start) {
+  std::size_t chars{static_cast<std::size_t>(state.GetLocation() - at)};
+  if (pass) {
+    ++entry.successes;
+    entry.consumed += chars;
+  } else {
+    ++entry.failures;
+    entry.backtracked += chars;
+  }
+  if (--entry.active == 0) {
+    entry.time += Clock::now() - start;
+  }
+}
+
+void ParserProfile::Merge(const ParserProfile &that) {
+  for (const auto &[key, from] : that.entries_) {
+    Entry &entry{entries_[key]};
+    entry.tag = from.tag;
+    entry.calls += from.calls;
+    entry.successes += from.successes;
+    entry.failures += from.failures;
+    entry.consumed += from.consumed;
+    entry.backtracked += from.backtracked;
+    entry.time += from.time;
+  }
+}
+
+void ParserProfile::Dump(std::ostream &o, std::size_t top) const {
+  std::vector<const Entry *> sorted;
+  for (const auto &pair : entries_) {
+    sorted.push_back(&pair.second);
+  }
+  std::sort(sorted.begin(), sorted.end(), [](const Entry *x, const Entry *y) {
+    return x->time > y->time || (x->time == y->time && x->calls > y->calls);
+  });
+  if (sorted.size() > top) {
+    sorted.resize(top);
+  }
+  o << "parser profile: " << entries_.size() << " productions\n"
+    << std::setw(10) << "msec" << std::setw(11) << "calls" << std::setw(11)
+    << "pass" << std::setw(11) << "fail" << std::setw(11) << "consumed"
+    << std::setw(11) << "backtrack"
+    << "  production\n";
+  for (const Entry *entry : sorted) {
+    double msec{
+        std::chrono::duration<double, std::milli>(entry->time).count()};
+    o << std::fixed << std::setprecision(3) << std::setw(10) << msec
+      << std::setw(11) << entry->calls << std::setw(11) << entry->successes
+      << std::setw(11) << entry->failures << std::setw(11) << entry->consumed
+      << std::setw(11) << entry->backtracked << "  " << entry->tag.ToString()
+      << '\n';
+  }
+}
 }
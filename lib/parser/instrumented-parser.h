@@ -19,9 +19,11 @@
 #include "parse-state.h"
 #include "provenance.h"
 #include "user-state.h"
+#include <chrono>
 #include <cstddef>
 #include <map>
 #include <ostream>
+#include <unordered_map>
 
 namespace Fortran::parser {
 
@@ -50,6 +52,33 @@ private:
   std::map<std::size_t, LogForPosition> perPos_;
 };
 
+// Aggregates the calls of each instrumented production, for finding the
+// hot spots of the grammar.  Characters consumed by a production that
+// fails are counted as backtracked; time is cumulative and includes the
+// time spent in nested productions, but not twice for recursive ones.
+class ParserProfile {
+public:
+  using Clock = std::chrono::steady_clock;
+  struct Entry {
+    CharBlock tag;
+    std::size_t calls{0}, successes{0}, failures{0};
+    std::size_t consumed{0}, backtracked{0};
+    Clock::duration time{Clock::duration::zero()};
+    int active{0};  // recursion depth
+  };
+
+  ParserProfile() {}
+
+  Entry &Start(const MessageFixedText &tag);
+  void Finish(Entry &, const char *at, bool pass, const ParseState &,
+      Clock::time_point start);
+  void Merge(const ParserProfile &);
+  void Dump(std::ostream &, std::size_t top) const;
+
+private:
+  std::unordered_map<const char *, Entry> entries_;  // keyed by tag text
+};
+
 template<typename PA> class InstrumentedParser {
 public:
   using resultType = typename PA::resultType;
@@ -58,22 +87,36 @@ public:
     : tag_{tag}, parser_{parser} {}
   std::optional<resultType> Parse(ParseState &state) const {
     if (UserState * ustate{state.userState()}) {
-      if (ParsingLog * log{ustate->log()}) {
+      if (ParserProfile * profile{ustate->parserProfile()}) {
         const char *at{state.GetLocation()};
-        if (log->Fails(at, tag_, state)) {
-          return std::nullopt;
-        }
-        Messages messages{std::move(state.messages())};
-        std::optional<resultType> result{parser_.Parse(state)};
-        log->Note(at, tag_, result.has_value(), state);
-        state.messages().Restore(std::move(messages));
+        ParserProfile::Entry &entry{profile->Start(tag_)};
+        auto start{ParserProfile::Clock::now()};
+        std::optional<resultType> result{ParseWithLog(state, *ustate)};
+        profile->Finish(entry, at, result.has_value(), state, start);
         return result;
       }
+      return ParseWithLog(state, *ustate);
     }
     return parser_.Parse(state);
   }
 
 private:
+  std::optional<resultType> ParseWithLog(
+      ParseState &state, UserState &ustate) const {
+    if (ParsingLog * log{ustate.log()}) {
+      const char *at{state.GetLocation()};
+      if (log->Fails(at, tag_, state)) {
+        return std::nullopt;
+      }
+      Messages messages{std::move(state.messages())};
+      std::optional<resultType> result{parser_.Parse(state)};
+      log->Note(at, tag_, result.has_value(), state);
+      state.messages().Restore(std::move(messages));
+      return result;
+    }
+    return parser_.Parse(state);
+  }
+
   const MessageFixedText tag_;
   const PA parser_;
 };
@@ -0,0 +1,275 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FORTRAN_PARSER_KEYWORD_DISPATCH_H_
+#define FORTRAN_PARSER_KEYWORD_DISPATCH_H_
+
+// dispatchOnKeyword(...) is a variant of first(...) for the long lists of
+// statement alternatives in the grammar.  It classifies the leading keyword
+// of the statement once, by looking at the letters that begin it (after any
+// label and construct name, with blanks ignored, as they are optional in
+// fixed form), and then attempts only those alternatives that can start
+// with that keyword, in their original order.  Alternatives are marked
+// with the keywords that they can start with:
+//   leadingKeyword("goto", p)        p starts with GO TO
+//   leadingKeyword("stop|errorstop", p)
+//   leadingKeyword("!", p)           p starts with a directive
+// Keywords are written in lower case without blanks.  Unmarked
+// alternatives, like assignment statements, are always attempted.
+//
+// The result, including the messages of a failed parse, is the same as
+// that of first(...) applied to all of the alternatives: an alternative
+// that cannot start with the leading keyword fails without matching a
+// token and so contributes nothing but its messages when it is the last
+// one, and it is attempted in that case.  When tokens may already have
+// been matched (a label, a construct name, or anything before the
+// statement), a failed dispatch is retried with all of the alternatives.
+
+#include "basic-parsers.h"
+#include "characters.h"
+#include "parse-state.h"
+#include <cinttypes>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Fortran::parser {
+
+template<typename PA> class LeadingKeywordParser {
+public:
+  using resultType = typename PA::resultType;
+  constexpr LeadingKeywordParser(const LeadingKeywordParser &) = default;
+  constexpr LeadingKeywordParser(const char *keywords, PA parser)
+    : keywords_{keywords}, parser_{parser} {}
+  constexpr const char *keywords() const { return keywords_; }
+  std::optional<resultType> Parse(ParseState &state) const {
+    return parser_.Parse(state);
+  }
+
+  // Can one of the keywords begin a statement that begins with these letters?
+  bool CanStartWith(const char *letters, std::size_t n, bool complete) const {
+    for (const char *p{keywords_}; *p != '\0';) {
+      std::size_t j{0};
+      for (; p[j] != '\0' && p[j] != '|' && j < n && p[j] == letters[j]; ++j) {
+      }
+      if (p[j] == '\0' || p[j] == '|' || (j == n && !complete)) {
+        return true;
+      }
+      for (p += j; *p != '\0' && *p++ != '|';) {
+      }
+    }
+    return false;
+  }
+
+private:
+  const char *keywords_;
+  const PA parser_;
+};
+
+template<typename PA>
+inline constexpr auto leadingKeyword(const char *keywords, PA parser) {
+  return LeadingKeywordParser<PA>{keywords, parser};
+}
+
+template<typename A> struct IsLeadingKeywordParser : std::false_type {};
+template<typename PA>
+struct IsLeadingKeywordParser<LeadingKeywordParser<PA>> : std::true_type {};
+
+// The letters that begin a statement, after any label and construct name
+struct LeadingLetters {
+  static constexpr std::size_t maxLetters{32};
+  explicit LeadingLetters(const ParseState &);
+  char letters[maxLetters];
+  std::size_t count{0};
+  bool complete{true};  // false when truncated
+  bool valid{false};  // false when the statement doesn't begin with a letter
+  bool anySkipped{false};  // label or construct name
+};
+
+inline LeadingLetters::LeadingLetters(const ParseState &state) {
+  const char *p{state.GetLocation()};
+  const char *limit{p + state.BytesRemaining()};
+  auto skipBlanks{[&]() {
+    while (p < limit && (*p == ' ' || *p == '\n')) {
+      ++p;
+    }
+  }};
+  skipBlanks();
+  if (p < limit && IsDecimalDigit(*p)) {
+    anySkipped = true;  // label
+    while (p < limit && IsDecimalDigit(*p)) {
+      ++p;
+    }
+    skipBlanks();
+  }
+  if (p >= limit || !IsLetter(*p)) {
+    return;
+  }
+  // Skip a construct name, if any
+  const char *start{p};
+  while (p < limit && (IsLegalInIdentifier(*p) || *p == ' ')) {
+    ++p;
+  }
+  if (p + 1 < limit && p[0] == ':' && p[1] != ':') {
+    anySkipped = true;
+    ++p;
+    while (p < limit && *p == ' ') {
+      ++p;
+    }
+    if (p >= limit || !IsLetter(*p)) {
+      return;
+    }
+  } else {
+    p = start;
+  }
+  for (; p < limit; ++p) {
+    if (IsLetter(*p)) {
+      if (count == maxLetters) {
+        complete = false;
+        break;
+      }
+      letters[count++] = ToLowerCaseLetter(*p);
+    } else if (*p != ' ') {
+      break;
+    }
+  }
+  valid = true;
+}
+
+template<typename... Ps> class KeywordDispatchParser {
+public:
+  using resultType =
+      typename std::tuple_element_t<0, std::tuple<Ps...>>::resultType;
+  static constexpr std::size_t alternatives{sizeof...(Ps)};
+  static_assert(alternatives <= 64);
+  constexpr KeywordDispatchParser(const KeywordDispatchParser &) = default;
+  constexpr KeywordDispatchParser(Ps... ps) : ps_{ps...} {
+    NoteKeywords(std::index_sequence_for<Ps...>{});
+  }
+  std::optional<resultType> Parse(ParseState &state) const {
+    Messages messages{std::move(state.messages())};
+    ParseState backtrack{state};
+    std::optional<resultType> result;
+    LeadingLetters leading{state};
+    if (!leading.valid) {
+      ParseAlternatives(result, state, backtrack, nullptr);
+    } else {
+      bool triedLast{ParseAlternatives(result, state, backtrack, &leading)};
+      if (!result) {
+        if (backtrack.anyTokenMatched() || leading.anySkipped) {
+          state.messages().clear();
+          state = backtrack;
+          ParseAlternatives(result, state, backtrack, nullptr);
+        } else if (!triedLast && !state.anyTokenMatched()) {
+          ParseState prevState{std::move(state)};
+          state = backtrack;
+          result = std::get<alternatives - 1>(ps_).Parse(state);
+          if (!result) {
+            state.CombineFailedParses(std::move(prevState));
+          }
+        }
+      }
+    }
+    state.messages().Restore(std::move(messages));
+    return result;
+  }
+
+private:
+  template<std::size_t... J>
+  constexpr void NoteKeywords(std::index_sequence<J...>) {
+    (NoteKeywords<J>(), ...);
+  }
+  template<std::size_t J> constexpr void NoteKeywords() {
+    using PA = std::tuple_element_t<J, std::tuple<Ps...>>;
+    std::uint64_t bit{std::uint64_t{1} << J};
+    if constexpr (IsLeadingKeywordParser<PA>::value) {
+      const char *p{std::get<J>(ps_).keywords()};
+      for (bool atStart{true}; *p != '\0'; ++p) {
+        if (atStart && *p >= 'a' && *p <= 'z') {
+          byLetter_[*p - 'a'] |= bit;
+        }
+        atStart = *p == '|';
+      }
+    } else {
+      for (std::uint64_t &mask : byLetter_) {
+        mask |= bit;
+      }
+    }
+  }
+
+  // Attempts the alternatives in order, or only those that can start with
+  // the leading letters when they are known; returns true when the last
+  // alternative was among them.
+  bool ParseAlternatives(std::optional<resultType> &result, ParseState &state,
+      const ParseState &backtrack, const LeadingLetters *leading) const {
+    std::uint64_t mask{~std::uint64_t{0}};
+    if (leading) {
+      mask = byLetter_[leading->letters[0] - 'a'];
+    }
+    bool tried{false};
+    ParseSome(result, state, backtrack, mask, leading, tried,
+        std::index_sequence_for<Ps...>{});
+    return (mask >> (alternatives - 1)) & 1;
+  }
+
+  template<std::size_t... J>
+  void ParseSome(std::optional<resultType> &result, ParseState &state,
+      const ParseState &backtrack, std::uint64_t &mask,
+      const LeadingLetters *leading, bool &tried,
+      std::index_sequence<J...>) const {
+    (ParseOne<J>(result, state, backtrack, mask, leading, tried) || ...);
+  }
+
+  template<std::size_t J>
+  bool ParseOne(std::optional<resultType> &result, ParseState &state,
+      const ParseState &backtrack, std::uint64_t &mask,
+      const LeadingLetters *leading, bool &tried) const {
+    using PA = std::tuple_element_t<J, std::tuple<Ps...>>;
+    const PA &parser{std::get<J>(ps_)};
+    if (!((mask >> J) & 1)) {
+      return false;
+    }
+    if constexpr (IsLeadingKeywordParser<PA>::value) {
+      if (leading &&
+          !parser.CanStartWith(
+              leading->letters, leading->count, leading->complete)) {
+        mask &= ~(std::uint64_t{1} << J);
+        return false;
+      }
+    }
+    if (tried) {
+      ParseState prevState{std::move(state)};
+      state = backtrack;
+      result = parser.Parse(state);
+      if (!result) {
+        state.CombineFailedParses(std::move(prevState));
+      }
+    } else {
+      tried = true;
+      result = parser.Parse(state);
+    }
+    return result.has_value();
+  }
+
+  const std::tuple<Ps...> ps_;
+  std::uint64_t byLetter_[26]{};
+};
+
+template<typename... Ps> inline constexpr auto dispatchOnKeyword(Ps... ps) {
+  return KeywordDispatchParser<Ps...>{ps...};
+}
+}
+#endif  // FORTRAN_PARSER_KEYWORD_DISPATCH_H_
@@ -0,0 +1,260 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FORTRAN_PARSER_LIST_H_
+#define FORTRAN_PARSER_LIST_H_
+
+// The container for the sequences in the parse tree.  Each element is
+// allocated separately, in the arena of the Parsing that produced it if
+// any, so its address never changes; the sequence itself is a contiguous
+// array of pointers to the elements, so traversals don't chase a chain
+// of pointers from one element to the next.  The interface is the part
+// of std::list<>'s that the compiler uses.  Unlike those of std::list<>,
+// iterators are invalidated by insertions and removals at or before
+// their positions, but references to the elements are not.
+
+#include "../common/arena.h"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Fortran::parser {
+
+template<typename A, typename BASE> class ListIterator {
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<A>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = A *;
+  using reference = A &;
+
+  ListIterator() {}
+  explicit ListIterator(BASE base) : base_{base} {}
+  template<typename B, typename BASE2,
+      typename = std::enable_if_t<std::is_convertible_v<BASE2, BASE>>>
+  ListIterator(const ListIterator<B, BASE2> &that) : base_{that.base()} {}
+
+  BASE base() const { return base_; }
+
+  A &operator*() const { return **base_; }
+  A *operator->() const { return *base_; }
+  A &operator[](difference_type n) const { return *base_[n]; }
+
+  ListIterator &operator++() {
+    ++base_;
+    return *this;
+  }
+  ListIterator operator++(int) { return ListIterator{base_++}; }
+  ListIterator &operator--() {
+    --base_;
+    return *this;
+  }
+  ListIterator operator--(int) { return ListIterator{base_--}; }
+  ListIterator &operator+=(difference_type n) {
+    base_ += n;
+    return *this;
+  }
+  ListIterator &operator-=(difference_type n) {
+    base_ -= n;
+    return *this;
+  }
+  ListIterator operator+(difference_type n) const {
+    return ListIterator{base_ + n};
+  }
+  ListIterator operator-(difference_type n) const {
+    return ListIterator{base_ - n};
+  }
+  template<typename B, typename BASE2>
+  difference_type operator-(const ListIterator<B, BASE2> &that) const {
+    return base_ - that.base();
+  }
+
+  template<typename B, typename BASE2>
+  bool operator==(const ListIterator<B, BASE2> &that) const {
+    return base_ == that.base();
+  }
+  template<typename B, typename BASE2>
+  bool operator!=(const ListIterator<B, BASE2> &that) const {
+    return base_ != that.base();
+  }
+  template<typename B, typename BASE2>
+  bool operator<(const ListIterator<B, BASE2> &that) const {
+    return base_ < that.base();
+  }
+  template<typename B, typename BASE2>
+  bool operator>(const ListIterator<B, BASE2> &that) const {
+    return base_ > that.base();
+  }
+  template<typename B, typename BASE2>
+  bool operator<=(const ListIterator<B, BASE2> &that) const {
+    return base_ <= that.base();
+  }
+  template<typename B, typename BASE2>
+  bool operator>=(const ListIterator<B, BASE2> &that) const {
+    return base_ >= that.base();
+  }
+
+private:
+  BASE base_{};
+};
+
+template<typename A> class List {
+  using Spine = std::vector<A *, common::ArenaAllocator<A *>>;
+
+public:
+  using value_type = A;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = A &;
+  using const_reference = const A &;
+  using iterator = ListIterator<A, typename Spine::iterator>;
+  using const_iterator = ListIterator<const A, typename Spine::const_iterator>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  List() {}
+  List(const List &that) {
+    spine_.reserve(that.size());
+    for (const A &x : that) {
+      spine_.push_back(common::Arena::New<A>(x));
+    }
+  }
+  List(List &&that) noexcept : spine_{std::move(that.spine_)} {
+    that.spine_.clear();
+  }
+  ~List() { clear(); }
+  List &operator=(const List &that) {
+    if (this != &that) {
+      List copy{that};
+      swap(copy);
+    }
+    return *this;
+  }
+  List &operator=(List &&that) noexcept {
+    if (this != &that) {
+      clear();
+      spine_.swap(that.spine_);
+    }
+    return *this;
+  }
+
+  iterator begin() { return iterator{spine_.begin()}; }
+  iterator end() { return iterator{spine_.end()}; }
+  const_iterator begin() const { return const_iterator{spine_.cbegin()}; }
+  const_iterator end() const { return const_iterator{spine_.cend()}; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+  reverse_iterator rbegin() { return reverse_iterator{end()}; }
+  reverse_iterator rend() { return reverse_iterator{begin()}; }
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator{end()};
+  }
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator{begin()};
+  }
+
+  bool empty() const { return spine_.empty(); }
+  size_type size() const { return spine_.size(); }
+
+  A &front() { return *spine_.front(); }
+  const A &front() const { return *spine_.front(); }
+  A &back() { return *spine_.back(); }
+  const A &back() const { return *spine_.back(); }
+
+  void clear() {
+    for (A *p : spine_) {
+      common::Arena::Delete(p);
+    }
+    spine_.clear();
+  }
+  void swap(List &that) { spine_.swap(that.spine_); }
+
+  template<typename... ARGS> A &emplace_back(ARGS &&... args) {
+    spine_.push_back(common::Arena::New<A>(std::forward<ARGS>(args)...));
+    return *spine_.back();
+  }
+  void push_back(const A &x) { emplace_back(x); }
+  void push_back(A &&x) { emplace_back(std::move(x)); }
+  template<typename... ARGS> A &emplace_front(ARGS &&... args) {
+    return *emplace(begin(), std::forward<ARGS>(args)...);
+  }
+  void push_front(const A &x) { emplace_front(x); }
+  void push_front(A &&x) { emplace_front(std::move(x)); }
+  void pop_front() { erase(begin()); }
+  void pop_back() { erase(--end()); }
+
+  template<typename... ARGS>
+  iterator emplace(const_iterator pos, ARGS &&... args) {
+    return iterator{spine_.insert(
+        pos.base(), common::Arena::New<A>(std::forward<ARGS>(args)...))};
+  }
+  iterator insert(const_iterator pos, const A &x) { return emplace(pos, x); }
+  iterator insert(const_iterator pos, A &&x) {
+    return emplace(pos, std::move(x));
+  }
+
+  iterator erase(const_iterator pos) { return erase(pos, std::next(pos)); }
+  iterator erase(const_iterator first, const_iterator last) {
+    for (auto iter{first.base()}; iter != last.base(); ++iter) {
+      common::Arena::Delete(*iter);
+    }
+    return iterator{spine_.erase(first.base(), last.base())};
+  }
+
+  // Moves elements from another list; they keep their addresses.
+  void splice(const_iterator pos, List &that) {
+    splice(pos, that, that.begin(), that.end());
+  }
+  void splice(const_iterator pos, List &&that) { splice(pos, that); }
+  void splice(const_iterator pos, List &that, const_iterator iter) {
+    splice(pos, that, iter, std::next(iter));
+  }
+  void splice(const_iterator pos, List &&that, const_iterator iter) {
+    splice(pos, that, iter);
+  }
+  void splice(const_iterator pos, List &that, const_iterator first,
+      const_iterator last) {
+    if (&that == this) {
+      // Rotate [first, last) into place.
+      auto at{spine_.begin() + (pos.base() - spine_.cbegin())};
+      auto from{spine_.begin() + (first.base() - spine_.cbegin())};
+      auto to{spine_.begin() + (last.base() - spine_.cbegin())};
+      if (at < from) {
+        std::rotate(at, from, to);
+      } else if (at > to) {
+        std::rotate(from, to, at);
+      }
+    } else {
+      spine_.insert(pos.base(), first.base(), last.base());
+      that.spine_.erase(first.base(), last.base());
+    }
+  }
+  void splice(const_iterator pos, List &&that, const_iterator first,
+      const_iterator last) {
+    splice(pos, that, first, last);
+  }
+
+  bool operator==(const List &that) const {
+    return size() == that.size() && std::equal(begin(), end(), that.begin());
+  }
+  bool operator!=(const List &that) const { return !(*this == that); }
+
+private:
+  Spine spine_;
+};
+}
+#endif  // FORTRAN_PARSER_LIST_H_
@@ -0,0 +1,75 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "memoized-parser.h"
+#include <algorithm>
+
+namespace Fortran::parser {
+
+ParseMemoTable::Key ParseMemoTable::MakeKey(
+    const void *parser, const ParseState &state) const {
+  int flags{(state.inFixedForm() << 0) | (state.deferMessages() << 1) |
+      (state.anyDeferredMessages() << 2) | (state.anyTokenMatched() << 3) |
+      (state.anyErrorRecovery() << 4) | (state.anyConformanceViolation() << 5)};
+  return Key{parser, state.GetLocation(), flags, state.context()};
+}
+
+const ParseMemoTable::Entry *ParseMemoTable::Find(const Key &key) {
+  ++lookups_;
+  auto iter{entries_.find(key)};
+  if (iter == entries_.end()) {
+    return nullptr;
+  }
+  ++hits_;
+  return &iter->second;
+}
+
+void ParseMemoTable::Note(const Key &key, const ParseState &state,
+    std::shared_ptr<const void> &&value) {
+  ++(value ? successes_ : failures_);
+  Messages messages;
+  messages.Copy(state.messages());
+  entries_.emplace(key, Entry{state, std::move(messages), std::move(value)});
+  peakEntries_ = std::max(peakEntries_, entries_.size());
+}
+
+void ParseMemoTable::StartStatement(const char *at) {
+  if (at != statement_) {
+    // Retries of the same statement, e.g. in the alternatives of
+    // a construct, can still use what was learned about it.
+    entries_.clear();
+    statement_ = at;
+    ++statements_;
+  }
+}
+
+void ParseMemoTable::AddStatistics(const ParseMemoTable &that) {
+  lookups_ += that.lookups_;
+  hits_ += that.hits_;
+  successes_ += that.successes_;
+  failures_ += that.failures_;
+  statements_ += that.statements_;
+  peakEntries_ = std::max(peakEntries_, that.peakEntries_);
+}
+
+void ParseMemoTable::Dump(std::ostream &o) const {
+  o << "parse memoization: " << statements_ << " statements, " << lookups_
+    << " lookups, " << hits_ << " hits";
+  if (lookups_ > 0) {
+    o << " (" << (100 * hits_ / lookups_) << "%)";
+  }
+  o << ", " << successes_ << " successes and " << failures_
+    << " failures recorded, " << peakEntries_ << " peak entries\n";
+}
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FORTRAN_PARSER_MEMOIZED_PARSER_H_
+#define FORTRAN_PARSER_MEMOIZED_PARSER_H_
+
+// memoized(p) is a parser that records the outcome of p at each position
+// in the current statement, so that when backtracking causes p to be
+// attempted again at the same position, the outcome is replayed rather
+// than recomputed.  Failures are always recorded, as are successes whose
+// result types can be copied; most parse tree nodes cannot be.  The parser
+// p must be stateless, e.g. a Parser<A> production, so that its type
+// identifies it, and it must not depend on or affect the UserState.
+// Memoization is enabled by Options::memoizeParse; the table is discarded
+// when the parse moves on to another statement.
+
+#include "message.h"
+#include "parse-state.h"
+#include "user-state.h"
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <type_traits>
+#include <unordered_map>
+
+namespace Fortran::parser {
+
+class ParseMemoTable {
+public:
+  struct Key {
+    bool operator==(const Key &that) const {
+      return parser == that.parser && at == that.at && flags == that.flags &&
+          context.get() == that.context.get();
+    }
+    const void *parser;
+    const char *at;
+    int flags;  // the parse state's flags affect the outcome
+    Message::Reference context;  // attached to any messages
+  };
+  struct Entry {
+    ParseState state;  // after the parse
+    Messages messages;  // emitted by the parse
+    std::shared_ptr<const void> value;  // null on failure
+  };
+
+  ParseMemoTable() {}
+
+  Key MakeKey(const void *parser, const ParseState &) const;
+  const Entry *Find(const Key &);
+  void Note(const Key &, const ParseState &, std::shared_ptr<const void> &&);
+
+  // Discards the table when the parse moves to another statement
+  void StartStatement(const char *at);
+
+  // Accumulates the statistics of a table used for part of the parse
+  void AddStatistics(const ParseMemoTable &);
+
+  void Dump(std::ostream &) const;
+
+private:
+  struct KeyHash {
+    std::size_t operator()(const Key &key) const {
+      return std::hash<const void *>{}(key.parser) ^
+          (std::hash<const char *>{}(key.at) << 3) ^
+          (std::hash<const Message *>{}(key.context.get()) << 1) ^ key.flags;
+    }
+  };
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+  const char *statement_{nullptr};
+  std::size_t lookups_{0}, hits_{0}, successes_{0}, failures_{0};
+  std::size_t statements_{0}, peakEntries_{0};
+};
+
+template<typename PA> class MemoizedParser {
+public:
+  using resultType = typename PA::resultType;
+  static_assert(std::is_empty_v<PA>, "memoized parser must be stateless");
+  constexpr MemoizedParser(const MemoizedParser &) = default;
+  constexpr MemoizedParser(const PA &parser) : parser_{parser} {}
+  std::optional<resultType> Parse(ParseState &state) const {
+    ParseMemoTable *table{nullptr};
+    if (UserState * ustate{state.userState()}) {
+      table = ustate->memoTable();
+    }
+    if (!table) {
+      return parser_.Parse(state);
+    }
+    auto key{table->MakeKey(&id, state)};
+    if (const auto *entry{table->Find(key)}) {
+      Message::Reference context{state.context()};
+      state = entry->state;  // does not affect messages
+      state.context() = std::move(context);
+      state.messages().Copy(entry->messages);
+      if constexpr (std::is_copy_constructible_v<resultType>) {
+        if (entry->value) {
+          return *static_cast<const resultType *>(entry->value.get());
+        }
+      }
+      return std::nullopt;
+    }
+    Messages messages{std::move(state.messages())};
+    std::optional<resultType> result{parser_.Parse(state)};
+    if (!result) {
+      table->Note(key, state, nullptr);
+    } else if constexpr (std::is_copy_constructible_v<resultType>) {
+      table->Note(key, state, std::make_shared<const resultType>(*result));
+    }
+    state.messages().Restore(std::move(messages));
+    return result;
+  }
+
+private:
+  static constexpr char id{'\0'};  // its address identifies the parser
+  const PA parser_;
+};
+
+template<typename PA> inline constexpr auto memoized(const PA &parser) {
+  return MemoizedParser<PA>{parser};
+}
+}
+#endif  // FORTRAN_PARSER_MEMOIZED_PARSER_H_
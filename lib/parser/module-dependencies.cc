@@ -0,0 +1,403 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "module-dependencies.h"
+#include "characters.h"
+#include "provenance.h"
+#include <cstring>
+#include <optional>
+#include <vector>
+
+// Cooked characters are lower case outside of literals, and blanks have
+// already been removed from fixed form source and squashed in free form
+// source, so "use foo" may appear as "usefoo".  The recognizer therefore
+// treats blanks as optional between keywords and names, and it identifies
+// a statement of interest by what must follow its names: the end of the
+// statement, or a comma in the case of USE.  That suffices to reject
+// assignments like "user = 1" or "module(1) = 2".
+
+namespace Fortran::parser {
+
+class StatementScanner {
+public:
+  StatementScanner(const char *p, const char *limit) : p_{p}, limit_{limit} {}
+
+  bool AtEnd() {
+    SkipBlanks();
+    return p_ >= limit_;
+  }
+
+  bool SkipBlanks() {
+    bool any{false};
+    while (p_ < limit_ && (*p_ == ' ' || *p_ == '\t')) {
+      ++p_, any = true;
+    }
+    return any;
+  }
+
+  bool Digits() {
+    SkipBlanks();
+    bool any{false};
+    while (p_ < limit_ && IsDecimalDigit(*p_)) {
+      ++p_, any = true;
+    }
+    return any;
+  }
+
+  void SkipLabel() { Digits(); }
+
+  bool Keyword(const char *keyword) {
+    SkipBlanks();
+    std::size_t n{std::strlen(keyword)};
+    if (static_cast<std::size_t>(limit_ - p_) >= n &&
+        std::memcmp(p_, keyword, n) == 0) {
+      p_ += n;
+      return true;
+    }
+    return false;
+  }
+
+  bool Char(char ch) {
+    SkipBlanks();
+    if (p_ < limit_ && *p_ == ch) {
+      ++p_;
+      return true;
+    }
+    return false;
+  }
+
+  // Skips a parenthesized sequence, e.g. a kind or length selector
+  bool Parenthesized() {
+    if (!Char('(')) {
+      return false;
+    }
+    for (int depth{1}; p_ < limit_; ++p_) {
+      if (*p_ == '(') {
+        ++depth;
+      } else if (*p_ == ')' && --depth == 0) {
+        ++p_;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::optional<std::string> Name() {
+    SkipBlanks();
+    if (p_ >= limit_ || !IsLegalIdentifierStart(*p_)) {
+      return std::nullopt;
+    }
+    std::string name;
+    for (; p_ < limit_ && IsLegalInIdentifier(*p_); ++p_) {
+      name += ToLowerCaseLetter(*p_);
+    }
+    return name;
+  }
+
+private:
+  const char *p_, *limit_;
+};
+
+static bool StartsWith(const std::string &str, const char *prefix) {
+  return str.compare(0, std::strlen(prefix), prefix) == 0;
+}
+
+static void ScanStatement(
+    const char *p, const char *limit, ModuleDependencies &result) {
+  StatementScanner stmt{p, limit};
+  stmt.SkipLabel();
+  if (stmt.AtEnd() || stmt.Char('!')) {
+    return;  // empty statement or compiler directive
+  }
+  if (stmt.Keyword("submodule")) {
+    // SUBMODULE ( ancestor [: parent] ) name
+    if (stmt.Char('(')) {
+      if (auto ancestor{stmt.Name()}) {
+        std::optional<std::string> parent;
+        if (stmt.Char(':')) {
+          parent = stmt.Name();
+          if (!parent) {
+            return;
+          }
+        }
+        if (stmt.Char(')')) {
+          if (auto name{stmt.Name()}) {
+            if (stmt.AtEnd()) {
+              result.defines.insert(*ancestor + '-' + *name);
+              result.uses.insert(*ancestor);
+              if (parent) {
+                result.uses.insert(*ancestor + '-' + *parent);
+              }
+            }
+          }
+        }
+      }
+    }
+  } else if (stmt.Keyword("module")) {
+    // MODULE name, but not MODULE PROCEDURE & al.
+    bool blank{stmt.SkipBlanks()};
+    if (auto name{stmt.Name()}) {
+      if (stmt.AtEnd() &&
+          (blank ||
+              !(StartsWith(*name, "procedure") ||
+                  StartsWith(*name, "subroutine") ||
+                  StartsWith(*name, "function")))) {
+        result.defines.insert(*name);
+      }
+    }
+  } else if (stmt.Keyword("use")) {
+    // USE [[, module-nature] ::] name [, rename-list | , ONLY: ...]
+    bool isIntrinsic{false};
+    if (stmt.Char(',')) {
+      if (stmt.Keyword("intrinsic")) {
+        isIntrinsic = true;
+      } else if (!stmt.Keyword("non_intrinsic")) {
+        return;
+      }
+      if (!stmt.Keyword("::")) {
+        return;
+      }
+    } else {
+      stmt.Keyword("::");
+    }
+    if (auto name{stmt.Name()}) {
+      if ((stmt.AtEnd() || stmt.Char(',')) && !isIntrinsic) {
+        result.uses.insert(*name);
+      }
+    }
+  }
+}
+
+ModuleDependencies ScanModuleDependencies(const char *p, std::size_t bytes) {
+  ModuleDependencies result;
+  const char *limit{p + bytes};
+  const char *start{p};
+  char quote{'\0'};
+  for (; p < limit; ++p) {
+    if (*p == '\n') {
+      ScanStatement(start, p, result);
+      start = p + 1;
+      quote = '\0';
+    } else if (quote != '\0') {
+      if (*p == quote) {
+        quote = '\0';
+      }
+    } else if (*p == '\'' || *p == '"') {
+      quote = *p;
+    } else if (*p == ';') {
+      ScanStatement(start, p, result);
+      start = p + 1;
+    } else if (*p == '!') {
+      // skip a compiler directive line, which is not subject to ';'
+      for (; p < limit && *p != '\n'; ++p) {
+      }
+      ScanStatement(start, p, result);
+      start = p + 1;
+    }
+  }
+  if (start < limit) {
+    ScanStatement(start, limit, result);
+  }
+  // A file's own modules are not dependencies.
+  for (const auto &name : result.defines) {
+    result.uses.erase(name);
+  }
+  return result;
+}
+
+// The statements that delimit program units, and those that
+// change the meaning of those that do
+enum class UnitStatement {
+  Empty,
+  Other,
+  Start,  // of a program unit or subprogram
+  End,  // of a program unit or subprogram
+  Interface,
+  EndInterface,
+  ModuleProcedure,  // starts a subprogram, but not in an interface
+};
+
+// Skips a type-spec that may prefix a FUNCTION statement
+static bool SkipTypePrefix(StatementScanner &stmt) {
+  static const char *types[]{"integer", "real", "logical", "complex",
+      "character", "doubleprecision", "doublecomplex", "byte"};
+  for (const char *type : types) {
+    StatementScanner save{stmt};
+    if (stmt.Keyword(type)) {
+      if (!stmt.Parenthesized() && stmt.Char('*') && !stmt.Parenthesized()) {
+        stmt.Digits();
+      }
+      return true;
+    }
+    stmt = save;
+  }
+  StatementScanner save{stmt};
+  if ((stmt.Keyword("type") || stmt.Keyword("class")) && stmt.Parenthesized()) {
+    return true;
+  }
+  stmt = save;
+  return false;
+}
+
+static UnitStatement ClassifyStatement(const char *p, const char *limit) {
+  StatementScanner stmt{p, limit};
+  stmt.SkipLabel();
+  if (stmt.AtEnd() || stmt.Char('!')) {
+    return UnitStatement::Empty;
+  }
+  if (stmt.Keyword("end")) {
+    if (stmt.AtEnd()) {
+      return UnitStatement::End;
+    }
+    if (stmt.Keyword("interface")) {
+      return UnitStatement::EndInterface;
+    }
+    if (stmt.Keyword("subroutine") || stmt.Keyword("function") ||
+        stmt.Keyword("submodule") || stmt.Keyword("module") ||
+        stmt.Keyword("program") || stmt.Keyword("procedure") ||
+        (stmt.Keyword("block") && stmt.Keyword("data"))) {
+      stmt.Name();
+      if (stmt.AtEnd()) {
+        return UnitStatement::End;
+      }
+    }
+    return UnitStatement::Other;
+  }
+  {
+    StatementScanner save{stmt};
+    stmt.Keyword("abstract");
+    if (stmt.Keyword("interface")) {
+      return UnitStatement::Interface;
+    }
+    stmt = save;
+  }
+  if (stmt.Keyword("submodule")) {
+    return stmt.Char('(') ? UnitStatement::Start : UnitStatement::Other;
+  }
+  if (stmt.Keyword("program") ||
+      (stmt.Keyword("block") && stmt.Keyword("data"))) {
+    return stmt.Name() && stmt.AtEnd() ? UnitStatement::Start
+                                       : UnitStatement::Other;
+  }
+  stmt = StatementScanner{p, limit};
+  stmt.SkipLabel();
+  bool modulePrefix{false};
+  while (true) {
+    if (stmt.Keyword("recursive") || stmt.Keyword("non_recursive") ||
+        stmt.Keyword("pure") || stmt.Keyword("impure") ||
+        stmt.Keyword("elemental")) {
+    } else if (stmt.Keyword("module")) {
+      modulePrefix = true;
+      if (stmt.Keyword("procedure")) {
+        return UnitStatement::ModuleProcedure;
+      }
+    } else if (!SkipTypePrefix(stmt)) {
+      break;
+    }
+  }
+  if ((stmt.Keyword("function") || stmt.Keyword("subroutine")) &&
+      stmt.Name()) {
+    return UnitStatement::Start;
+  }
+  if (modulePrefix) {
+    // MODULE name
+    stmt = StatementScanner{p, limit};
+    stmt.SkipLabel();
+    if (stmt.Keyword("module") && stmt.Name() && stmt.AtEnd()) {
+      return UnitStatement::Start;
+    }
+  }
+  return UnitStatement::Other;
+}
+
+std::vector<const char *> FindProgramUnitBoundaries(
+    const char *p, std::size_t bytes) {
+  std::vector<const char *> result;
+  const char *limit{p + bytes};
+  const char *start{p};
+  char quote{'\0'};
+  int depth{0}, interfaceDepth{0};
+  bool inUnit{false};
+  auto note{[&](const char *statementLimit) {
+    switch (ClassifyStatement(start, statementLimit)) {
+    case UnitStatement::Empty:
+      break;
+    case UnitStatement::Start:
+      ++depth;
+      inUnit = true;
+      break;
+    case UnitStatement::ModuleProcedure:
+      if (interfaceDepth == 0) {
+        ++depth;
+        inUnit = true;
+      }
+      break;
+    case UnitStatement::End:
+      if (depth > 0) {
+        --depth;
+      }
+      break;
+    case UnitStatement::Interface:
+      ++interfaceDepth;
+      break;
+    case UnitStatement::EndInterface:
+      if (interfaceDepth > 0) {
+        --interfaceDepth;
+      }
+      break;
+    case UnitStatement::Other:
+      if (depth == 0) {
+        depth = 1;  // a main program without a PROGRAM statement
+        inUnit = true;
+      }
+      break;
+    }
+  }};
+  for (; p < limit; ++p) {
+    if (*p == '\n') {
+      note(p);
+      start = p + 1;
+      quote = '\0';
+      if (depth == 0 && inUnit && start < limit) {
+        result.push_back(start);
+        inUnit = false;
+      }
+    } else if (quote != '\0') {
+      if (*p == quote) {
+        quote = '\0';
+      }
+    } else if (*p == '\'' || *p == '"') {
+      quote = *p;
+    } else if (*p == ';') {
+      note(p);
+      start = p + 1;
+    } else if (*p == '!') {
+      // a compiler directive line, which is not subject to ';'
+      static const char fixed[]{"!dir$ fixed"}, free[]{"!dir$ free"};
+      if (std::strncmp(p, fixed, sizeof fixed - 1) == 0 ||
+          std::strncmp(p, free, sizeof free - 1) == 0) {
+        return {};
+      }
+      for (; p + 1 < limit && p[1] != '\n'; ++p) {
+      }
+    }
+  }
+  return result;
+}
+
+ModuleDependencies ScanModuleDependencies(const CookedSource &cooked) {
+  const std::string &data{cooked.data()};
+  return ScanModuleDependencies(data.data(), data.size());
+}
+}
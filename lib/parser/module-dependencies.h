@@ -0,0 +1,50 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FORTRAN_PARSER_MODULE_DEPENDENCIES_H_
+#define FORTRAN_PARSER_MODULE_DEPENDENCIES_H_
+
+// A lightweight recognizer for MODULE, SUBMODULE, and USE statements
+// in cooked character streams.  It allows a driver to discover the
+// module files that a source file will produce and consume without
+// running the full parser and semantics.  A similar recognizer finds
+// the boundaries between program units so that they can be parsed
+// independently.
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace Fortran::parser {
+
+class CookedSource;
+
+struct ModuleDependencies {
+  // Module names are lower case.  Submodules appear as "ancestor-name",
+  // matching their module file names.
+  std::set<std::string> defines;  // MODULE and SUBMODULE statements
+  std::set<std::string> uses;  // USE statements and SUBMODULE parents
+};
+
+ModuleDependencies ScanModuleDependencies(const CookedSource &);
+ModuleDependencies ScanModuleDependencies(const char *, std::size_t);
+
+// Returns the positions in cooked characters that follow the lines that
+// end top-level program units, apart from the last one.  The result is
+// a guess that the parser must confirm; it is empty when the source
+// contains directives that change the source form.
+std::vector<const char *> FindProgramUnitBoundaries(const char *, std::size_t);
+}
+#endif  // FORTRAN_PARSER_MODULE_DEPENDENCIES_H_
@@ -43,6 +43,8 @@ public:
   // TODO: Add a constructor for parsing a normalized module file.
   ParseState(const CookedSource &cooked)
     : p_{&cooked.data().front()}, limit_{&cooked.data().back() + 1} {}
+  // Parses a range of the cooked characters
+  ParseState(const char *p, const char *limit) : p_{p}, limit_{limit} {}
   ParseState(const ParseState &that)
     : p_{that.p_}, limit_{that.limit_}, context_{that.context_},
       userState_{that.userState_}, inFixedForm_{that.inFixedForm_},
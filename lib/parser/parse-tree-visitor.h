@@ -76,14 +76,14 @@ template<typename T, typename M> void Walk(std::optional<T> &x, M &mutator) {
   }
 }
 // For most lists, just traverse the elements; but when a list constitutes
-// a Block (i.e., std::list<ExecutionPartConstruct>), also invoke the
+// a Block (i.e., List<ExecutionPartConstruct>), also invoke the
 // visitor/mutator on the list itself.
-template<typename T, typename V> void Walk(const std::list<T> &x, V &visitor) {
+template<typename T, typename V> void Walk(const List<T> &x, V &visitor) {
   for (const auto &elem : x) {
     Walk(elem, visitor);
   }
 }
-template<typename T, typename M> void Walk(std::list<T> &x, M &mutator) {
+template<typename T, typename M> void Walk(List<T> &x, M &mutator) {
   for (auto &elem : x) {
     Walk(elem, mutator);
   }
@@ -28,7 +28,7 @@ struct GenericExprWrapper {
 namespace Fortran::parser {
 
 // R867
-ImportStmt::ImportStmt(common::ImportKind &&k, std::list<Name> &&n)
+ImportStmt::ImportStmt(common::ImportKind &&k, List<Name> &&n)
   : kind{k}, names(std::move(n)) {
   CHECK(kind == common::ImportKind::Default ||
       kind == common::ImportKind::Only || names.empty());
@@ -36,7 +36,7 @@ ImportStmt::ImportStmt(common::ImportKind &&k, std::list<Name> &&n)
 
 // R873
 CommonStmt::CommonStmt(std::optional<Name> &&name,
-    std::list<CommonBlockObject> &&objects, std::list<Block> &&others) {
+    List<CommonBlockObject> &&objects, List<Block> &&others) {
   blocks.emplace_front(std::move(name), std::move(objects));
   blocks.splice(blocks.end(), std::move(others));
 }
@@ -56,7 +56,7 @@ bool Designator::EndsInBareName() const {
 }
 
 // R911 data-ref -> part-ref [% part-ref]...
-DataRef::DataRef(std::list<PartRef> &&prl) : u{std::move(prl.front().name)} {
+DataRef::DataRef(List<PartRef> &&prl) : u{std::move(prl.front().name)} {
   for (bool first{true}; !prl.empty(); first = false, prl.pop_front()) {
     PartRef &pr{prl.front()};
     if (!first) {
@@ -104,8 +104,8 @@ bool DoConstruct::IsDoConcurrent() const {
 }
 
 static Designator MakeArrayElementRef(
-    const Name &name, std::list<Expr> &&subscripts) {
-  ArrayElement arrayElement{DataRef{Name{name}}, std::list<SectionSubscript>{}};
+    const Name &name, List<Expr> &&subscripts) {
+  ArrayElement arrayElement{DataRef{Name{name}}, List<SectionSubscript>{}};
   for (Expr &expr : subscripts) {
     arrayElement.subscripts.push_back(
         SectionSubscript{Integer{common::Indirection{std::move(expr)}}});
@@ -114,9 +114,9 @@ static Designator MakeArrayElementRef(
 }
 
 static Designator MakeArrayElementRef(
-    StructureComponent &&sc, std::list<Expr> &&subscripts) {
+    StructureComponent &&sc, List<Expr> &&subscripts) {
   ArrayElement arrayElement{DataRef{common::Indirection{std::move(sc)}},
-      std::list<SectionSubscript>{}};
+      List<SectionSubscript>{}};
   for (Expr &expr : subscripts) {
     arrayElement.subscripts.push_back(
         SectionSubscript{Integer{common::Indirection{std::move(expr)}}});
@@ -154,8 +154,8 @@ static Expr ActualArgToExpr(ActualArgSpec &arg) {
 }
 
 Designator FunctionReference::ConvertToArrayElementRef() {
-  std::list<Expr> args;
-  for (auto &arg : std::get<std::list<ActualArgSpec>>(v.t)) {
+  List<Expr> args;
+  for (auto &arg : std::get<List<ActualArgSpec>>(v.t)) {
     args.emplace_back(ActualArgToExpr(arg));
   }
   return std::visit(
@@ -175,8 +175,8 @@ Designator FunctionReference::ConvertToArrayElementRef() {
 StructureConstructor FunctionReference::ConvertToStructureConstructor(
     const semantics::DerivedTypeSpec &derived) {
   Name name{std::get<parser::Name>(std::get<ProcedureDesignator>(v.t).u)};
-  std::list<ComponentSpec> components;
-  for (auto &arg : std::get<std::list<ActualArgSpec>>(v.t)) {
+  List<ComponentSpec> components;
+  for (auto &arg : std::get<List<ActualArgSpec>>(v.t)) {
     std::optional<Keyword> keyword;
     if (auto &kw{std::get<std::optional<Keyword>>(arg.t)}) {
       keyword.emplace(Keyword{Name{kw->v}});
@@ -184,7 +184,7 @@ StructureConstructor FunctionReference::ConvertToStructureConstructor(
     components.emplace_back(
         std::move(keyword), ComponentDataSource{ActualArgToExpr(arg)});
   }
-  DerivedTypeSpec spec{std::move(name), std::list<TypeParamSpec>{}};
+  DerivedTypeSpec spec{std::move(name), List<TypeParamSpec>{}};
   spec.derivedTypeSpec = &derived;
   return StructureConstructor{std::move(spec), std::move(components)};
 }
@@ -204,10 +204,10 @@ Substring ArrayElement::ConvertToSubstring() {
 // Convert this stmt-function-stmt to an array element assignment statement.
 Statement<ActionStmt> StmtFunctionStmt::ConvertToAssignment() {
   auto &funcName{std::get<Name>(t)};
-  auto &funcArgs{std::get<std::list<Name>>(t)};
+  auto &funcArgs{std::get<List<Name>>(t)};
   auto &funcExpr{std::get<Scalar<Expr>>(t).thing};
   CharBlock source{funcName.source};
-  std::list<Expr> subscripts;
+  List<Expr> subscripts;
   for (Name &arg : funcArgs) {
     subscripts.push_back(WithSource(arg.source,
         Expr{common::Indirection{
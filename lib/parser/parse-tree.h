@@ -26,13 +26,13 @@
 #include "char-block.h"
 #include "characters.h"
 #include "format-specification.h"
+#include "list.h"
 #include "message.h"
 #include "provenance.h"
 #include "../common/Fortran.h"
 #include "../common/idioms.h"
 #include "../common/indirection.h"
 #include <cinttypes>
-#include <list>
 #include <memory>
 #include <optional>
 #include <string>
@@ -407,7 +407,7 @@ struct ImplicitPartStmt {
 };
 
 // R505 implicit-part -> [implicit-part-stmt]... implicit-stmt
-WRAPPER_CLASS(ImplicitPart, std::list<ImplicitPartStmt>);
+WRAPPER_CLASS(ImplicitPart, List<ImplicitPartStmt>);
 
 // R507 declaration-construct ->
 //        specification-construct | data-stmt | format-stmt |
@@ -427,10 +427,10 @@ struct DeclarationConstruct {
 // from the implicit part to the declaration constructs
 struct SpecificationPart {
   TUPLE_CLASS_BOILERPLATE(SpecificationPart);
-  std::tuple<std::list<OpenMPDeclarativeConstruct>,
-      std::list<Statement<common::Indirection<UseStmt>>>,
-      std::list<Statement<common::Indirection<ImportStmt>>>, ImplicitPart,
-      std::list<DeclarationConstruct>>
+  std::tuple<List<OpenMPDeclarativeConstruct>,
+      List<Statement<common::Indirection<UseStmt>>>,
+      List<Statement<common::Indirection<ImportStmt>>>, ImplicitPart,
+      List<DeclarationConstruct>>
       t;
 };
 
@@ -448,7 +448,7 @@ EMPTY_CLASS(ContainsStmt);
 // R511 internal-subprogram-part -> contains-stmt [internal-subprogram]...
 struct InternalSubprogramPart {
   TUPLE_CLASS_BOILERPLATE(InternalSubprogramPart);
-  std::tuple<Statement<ContainsStmt>, std::list<InternalSubprogram>> t;
+  std::tuple<Statement<ContainsStmt>, List<InternalSubprogram>> t;
 };
 
 // R1159 continue-stmt -> CONTINUE
@@ -530,7 +530,7 @@ struct ExecutionPartConstruct {
 };
 
 // R509 execution-part -> executable-construct [execution-part-construct]...
-WRAPPER_CLASS(ExecutionPart, std::list<ExecutionPartConstruct>);
+WRAPPER_CLASS(ExecutionPart, List<ExecutionPartConstruct>);
 
 // R502 program-unit ->
 //        main-program | external-subprogram | module | submodule | block-data
@@ -546,7 +546,7 @@ struct ProgramUnit {
 
 // R501 program -> program-unit [program-unit]...
 // This is the top-level production.
-WRAPPER_CLASS(Program, std::list<ProgramUnit>);
+WRAPPER_CLASS(Program, List<ProgramUnit>);
 
 // R603 name -> letter [alphanumeric-character]...
 struct Name {
@@ -590,10 +590,10 @@ using ObjectName = Name;
 struct ImportStmt {
   BOILERPLATE(ImportStmt);
   ImportStmt(common::ImportKind &&k) : kind{k} {}
-  ImportStmt(std::list<Name> &&n) : names(std::move(n)) {}
-  ImportStmt(common::ImportKind &&, std::list<Name> &&);
+  ImportStmt(List<Name> &&n) : names(std::move(n)) {}
+  ImportStmt(common::ImportKind &&, List<Name> &&);
   common::ImportKind kind{common::ImportKind::Default};
-  std::list<Name> names;
+  List<Name> names;
 };
 
 // R868 namelist-stmt ->
@@ -603,9 +603,9 @@ struct ImportStmt {
 struct NamelistStmt {
   struct Group {
     TUPLE_CLASS_BOILERPLATE(Group);
-    std::tuple<Name, std::list<Name>> t;
+    std::tuple<Name, List<Name>> t;
   };
-  WRAPPER_CLASS_BOILERPLATE(NamelistStmt, std::list<Group>);
+  WRAPPER_CLASS_BOILERPLATE(NamelistStmt, List<Group>);
 };
 
 // R701 type-param-value -> scalar-int-expr | * | :
@@ -706,7 +706,7 @@ struct TypeParamSpec {
 struct DerivedTypeSpec {
   TUPLE_CLASS_BOILERPLATE(DerivedTypeSpec);
   mutable const semantics::DerivedTypeSpec *derivedTypeSpec{nullptr};
-  std::tuple<Name, std::list<TypeParamSpec>> t;
+  std::tuple<Name, List<TypeParamSpec>> t;
 };
 
 // R702 type-spec -> intrinsic-type-spec | derived-type-spec
@@ -880,7 +880,7 @@ struct TypeAttrSpec {
 //        TYPE [[, type-attr-spec-list] ::] type-name [( type-param-name-list )]
 struct DerivedTypeStmt {
   TUPLE_CLASS_BOILERPLATE(DerivedTypeStmt);
-  std::tuple<std::list<TypeAttrSpec>, Name, std::list<Name>> t;
+  std::tuple<List<TypeAttrSpec>, Name, List<Name>> t;
 };
 
 // R731 sequence-stmt -> SEQUENCE
@@ -907,7 +907,7 @@ struct TypeParamDecl {
 // R734 type-param-attr-spec -> KIND | LEN
 struct TypeParamDefStmt {
   TUPLE_CLASS_BOILERPLATE(TypeParamDefStmt);
-  std::tuple<IntegerTypeSpec, common::TypeParamAttr, std::list<TypeParamDecl>>
+  std::tuple<IntegerTypeSpec, common::TypeParamAttr, List<TypeParamDecl>>
       t;
 };
 
@@ -932,7 +932,7 @@ WRAPPER_CLASS(DeferredCoshapeSpecList, int);
 // R813 upper-cobound -> specification-expr
 struct ExplicitCoshapeSpec {
   TUPLE_CLASS_BOILERPLATE(ExplicitCoshapeSpec);
-  std::tuple<std::list<ExplicitShapeSpec>, std::optional<SpecificationExpr>> t;
+  std::tuple<List<ExplicitShapeSpec>, std::optional<SpecificationExpr>> t;
 };
 
 // R809 coarray-spec -> deferred-coshape-spec-list | explicit-coshape-spec
@@ -949,7 +949,7 @@ WRAPPER_CLASS(DeferredShapeSpecList, int);
 //        explicit-shape-spec-list | deferred-shape-spec-list
 struct ComponentArraySpec {
   UNION_CLASS_BOILERPLATE(ComponentArraySpec);
-  std::variant<std::list<ExplicitShapeSpec>, DeferredShapeSpecList> u;
+  std::variant<List<ExplicitShapeSpec>, DeferredShapeSpecList> u;
 };
 
 // R738 component-attr-spec ->
@@ -981,7 +981,7 @@ using InitialDataTarget = common::Indirection<Designator>;
 struct Initialization {
   UNION_CLASS_BOILERPLATE(Initialization);
   std::variant<ConstantExpr, NullInit, InitialDataTarget,
-      std::list<common::Indirection<DataStmtValue>>>
+      List<common::Indirection<DataStmtValue>>>
       u;
 };
 
@@ -1002,8 +1002,8 @@ struct ComponentDecl {
 //        component-decl-list
 struct DataComponentDefStmt {
   TUPLE_CLASS_BOILERPLATE(DataComponentDefStmt);
-  std::tuple<DeclarationTypeSpec, std::list<ComponentAttrSpec>,
-      std::list<ComponentDecl>>
+  std::tuple<DeclarationTypeSpec, List<ComponentAttrSpec>,
+      List<ComponentDecl>>
       t;
 };
 
@@ -1041,8 +1041,8 @@ struct ProcDecl {
 //          :: proc-decl-list
 struct ProcComponentDefStmt {
   TUPLE_CLASS_BOILERPLATE(ProcComponentDefStmt);
-  std::tuple<std::optional<ProcInterface>, std::list<ProcComponentAttrSpec>,
-      std::list<ProcDecl>>
+  std::tuple<std::optional<ProcInterface>, List<ProcComponentAttrSpec>,
+      List<ProcDecl>>
       t;
 };
 
@@ -1080,19 +1080,19 @@ struct TypeBoundProcedureStmt {
   struct WithoutInterface {
     BOILERPLATE(WithoutInterface);
     WithoutInterface(
-        std::list<BindAttr> &&as, std::list<TypeBoundProcDecl> &&ds)
+        List<BindAttr> &&as, List<TypeBoundProcDecl> &&ds)
       : attributes(std::move(as)), declarations(std::move(ds)) {}
-    std::list<BindAttr> attributes;
-    std::list<TypeBoundProcDecl> declarations;
+    List<BindAttr> attributes;
+    List<TypeBoundProcDecl> declarations;
   };
   struct WithInterface {
     BOILERPLATE(WithInterface);
-    WithInterface(Name &&n, std::list<BindAttr> &&as, std::list<Name> &&bs)
+    WithInterface(Name &&n, List<BindAttr> &&as, List<Name> &&bs)
       : interfaceName(std::move(n)), attributes(std::move(as)),
         bindingNames(std::move(bs)) {}
     Name interfaceName;
-    std::list<BindAttr> attributes;
-    std::list<Name> bindingNames;
+    List<BindAttr> attributes;
+    List<Name> bindingNames;
   };
   std::variant<WithoutInterface, WithInterface> u;
 };
@@ -1102,12 +1102,12 @@ struct TypeBoundProcedureStmt {
 struct TypeBoundGenericStmt {
   TUPLE_CLASS_BOILERPLATE(TypeBoundGenericStmt);
   std::tuple<std::optional<AccessSpec>, common::Indirection<GenericSpec>,
-      std::list<Name>>
+      List<Name>>
       t;
 };
 
 // R753 final-procedure-stmt -> FINAL [::] final-subroutine-name-list
-WRAPPER_CLASS(FinalProcedureStmt, std::list<Name>);
+WRAPPER_CLASS(FinalProcedureStmt, List<Name>);
 
 // R748 type-bound-proc-binding ->
 //        type-bound-procedure-stmt | type-bound-generic-stmt |
@@ -1124,7 +1124,7 @@ struct TypeBoundProcBinding {
 struct TypeBoundProcedurePart {
   TUPLE_CLASS_BOILERPLATE(TypeBoundProcedurePart);
   std::tuple<Statement<ContainsStmt>, std::optional<Statement<PrivateStmt>>,
-      std::list<Statement<TypeBoundProcBinding>>>
+      List<Statement<TypeBoundProcBinding>>>
       t;
 };
 
@@ -1137,9 +1137,9 @@ WRAPPER_CLASS(EndTypeStmt, std::optional<Name>);
 // R735 component-part -> [component-def-stmt]...
 struct DerivedTypeDef {
   TUPLE_CLASS_BOILERPLATE(DerivedTypeDef);
-  std::tuple<Statement<DerivedTypeStmt>, std::list<Statement<TypeParamDefStmt>>,
-      std::list<Statement<PrivateOrSequence>>,
-      std::list<Statement<ComponentDefStmt>>,
+  std::tuple<Statement<DerivedTypeStmt>, List<Statement<TypeParamDefStmt>>,
+      List<Statement<PrivateOrSequence>>,
+      List<Statement<ComponentDefStmt>>,
       std::optional<TypeBoundProcedurePart>, Statement<EndTypeStmt>>
       t;
 };
@@ -1158,7 +1158,7 @@ struct ComponentSpec {
 // R756 structure-constructor -> derived-type-spec ( [component-spec-list] )
 struct StructureConstructor {
   TUPLE_CLASS_BOILERPLATE(StructureConstructor);
-  std::tuple<DerivedTypeSpec, std::list<ComponentSpec>> t;
+  std::tuple<DerivedTypeSpec, List<ComponentSpec>> t;
 };
 
 // R760 enum-def-stmt -> ENUM, BIND(C)
@@ -1171,7 +1171,7 @@ struct Enumerator {
 };
 
 // R761 enumerator-def-stmt -> ENUMERATOR [::] enumerator-list
-WRAPPER_CLASS(EnumeratorDefStmt, std::list<Enumerator>);
+WRAPPER_CLASS(EnumeratorDefStmt, List<Enumerator>);
 
 // R763 end-enum-stmt -> END ENUM
 EMPTY_CLASS(EndEnumStmt);
@@ -1181,7 +1181,7 @@ EMPTY_CLASS(EndEnumStmt);
 //        end-enum-stmt
 struct EnumDef {
   TUPLE_CLASS_BOILERPLATE(EnumDef);
-  std::tuple<Statement<EnumDefStmt>, std::list<Statement<EnumeratorDefStmt>>,
+  std::tuple<Statement<EnumDefStmt>, List<Statement<EnumeratorDefStmt>>,
       Statement<EndEnumStmt>>
       t;
 };
@@ -1201,11 +1201,11 @@ struct AcValue {
 // R770 ac-spec -> type-spec :: | [type-spec ::] ac-value-list
 struct AcSpec {
   BOILERPLATE(AcSpec);
-  AcSpec(std::optional<TypeSpec> &&ts, std::list<AcValue> &&xs)
+  AcSpec(std::optional<TypeSpec> &&ts, List<AcValue> &&xs)
     : type(std::move(ts)), values(std::move(xs)) {}
   explicit AcSpec(TypeSpec &&ts) : type{std::move(ts)} {}
   std::optional<TypeSpec> type;
-  std::list<AcValue> values;
+  List<AcValue> values;
 };
 
 // R769 array-constructor -> (/ ac-spec /) | lbracket ac-spec rbracket
@@ -1242,7 +1242,7 @@ struct AcImpliedDoControl {
 // R774 ac-implied-do -> ( ac-value-list , ac-implied-do-control )
 struct AcImpliedDo {
   TUPLE_CLASS_BOILERPLATE(AcImpliedDo);
-  std::tuple<std::list<AcValue>, AcImpliedDoControl> t;
+  std::tuple<List<AcValue>, AcImpliedDoControl> t;
 };
 
 // R808 language-binding-spec ->
@@ -1258,7 +1258,7 @@ struct NamedConstantDef {
 };
 
 // R851 parameter-stmt -> PARAMETER ( named-constant-def-list )
-WRAPPER_CLASS(ParameterStmt, std::list<NamedConstantDef>);
+WRAPPER_CLASS(ParameterStmt, List<NamedConstantDef>);
 
 // R819 assumed-shape-spec -> [lower-bound] :
 WRAPPER_CLASS(AssumedShapeSpec, std::optional<SpecificationExpr>);
@@ -1269,14 +1269,14 @@ WRAPPER_CLASS(AssumedImpliedSpec, std::optional<SpecificationExpr>);
 // R822 assumed-size-spec -> explicit-shape-spec-list , assumed-implied-spec
 struct AssumedSizeSpec {
   TUPLE_CLASS_BOILERPLATE(AssumedSizeSpec);
-  std::tuple<std::list<ExplicitShapeSpec>, AssumedImpliedSpec> t;
+  std::tuple<List<ExplicitShapeSpec>, AssumedImpliedSpec> t;
 };
 
 // R823 implied-shape-or-assumed-size-spec -> assumed-implied-spec
 // R824 implied-shape-spec -> assumed-implied-spec , assumed-implied-spec-list
 // I.e., when the assumed-implied-spec-list has a single item, it constitutes an
 // implied-shape-or-assumed-size-spec; otherwise, an implied-shape-spec.
-WRAPPER_CLASS(ImpliedShapeSpec, std::list<AssumedImpliedSpec>);
+WRAPPER_CLASS(ImpliedShapeSpec, List<AssumedImpliedSpec>);
 
 // R825 assumed-rank-spec -> ..
 EMPTY_CLASS(AssumedRankSpec);
@@ -1287,7 +1287,7 @@ EMPTY_CLASS(AssumedRankSpec);
 //        implied-shape-or-assumed-size-spec | assumed-rank-spec
 struct ArraySpec {
   UNION_CLASS_BOILERPLATE(ArraySpec);
-  std::variant<std::list<ExplicitShapeSpec>, std::list<AssumedShapeSpec>,
+  std::variant<List<ExplicitShapeSpec>, List<AssumedShapeSpec>,
       DeferredShapeSpecList, AssumedSizeSpec, ImpliedShapeSpec, AssumedRankSpec>
       u;
 };
@@ -1337,7 +1337,7 @@ struct EntityDecl {
 //        declaration-type-spec [[, attr-spec]... ::] entity-decl-list
 struct TypeDeclarationStmt {
   TUPLE_CLASS_BOILERPLATE(TypeDeclarationStmt);
-  std::tuple<DeclarationTypeSpec, std::list<AttrSpec>, std::list<EntityDecl>> t;
+  std::tuple<DeclarationTypeSpec, List<AttrSpec>, List<EntityDecl>> t;
 };
 
 // R828 access-id -> access-name | generic-spec
@@ -1349,7 +1349,7 @@ struct AccessId {
 // R827 access-stmt -> access-spec [[::] access-id-list]
 struct AccessStmt {
   TUPLE_CLASS_BOILERPLATE(AccessStmt);
-  std::tuple<AccessSpec, std::list<AccessId>> t;
+  std::tuple<AccessSpec, List<AccessId>> t;
 };
 
 // R830 allocatable-decl ->
@@ -1363,10 +1363,10 @@ struct ObjectDecl {
 };
 
 // R829 allocatable-stmt -> ALLOCATABLE [::] allocatable-decl-list
-WRAPPER_CLASS(AllocatableStmt, std::list<ObjectDecl>);
+WRAPPER_CLASS(AllocatableStmt, List<ObjectDecl>);
 
 // R831 asynchronous-stmt -> ASYNCHRONOUS [::] object-name-list
-WRAPPER_CLASS(AsynchronousStmt, std::list<ObjectName>);
+WRAPPER_CLASS(AsynchronousStmt, List<ObjectName>);
 
 // R833 bind-entity -> entity-name | / common-block-name /
 struct BindEntity {
@@ -1378,7 +1378,7 @@ struct BindEntity {
 // R832 bind-stmt -> language-binding-spec [::] bind-entity-list
 struct BindStmt {
   TUPLE_CLASS_BOILERPLATE(BindStmt);
-  std::tuple<LanguageBindingSpec, std::list<BindEntity>> t;
+  std::tuple<LanguageBindingSpec, List<BindEntity>> t;
 };
 
 // R835 codimension-decl -> coarray-name lbracket coarray-spec rbracket
@@ -1388,10 +1388,10 @@ struct CodimensionDecl {
 };
 
 // R834 codimension-stmt -> CODIMENSION [::] codimension-decl-list
-WRAPPER_CLASS(CodimensionStmt, std::list<CodimensionDecl>);
+WRAPPER_CLASS(CodimensionStmt, List<CodimensionDecl>);
 
 // R836 contiguous-stmt -> CONTIGUOUS [::] object-name-list
-WRAPPER_CLASS(ContiguousStmt, std::list<ObjectName>);
+WRAPPER_CLASS(ContiguousStmt, List<ObjectName>);
 
 // R847 constant-subobject -> designator
 // R846 int-constant-subobject -> constant-subobject
@@ -1444,7 +1444,7 @@ struct DataIDoObject {
 struct DataImpliedDo {
   TUPLE_CLASS_BOILERPLATE(DataImpliedDo);
   using Bounds = LoopBounds<DoVariable, ScalarIntConstantExpr>;
-  std::tuple<std::list<DataIDoObject>, std::optional<IntegerTypeSpec>, Bounds>
+  std::tuple<List<DataIDoObject>, std::optional<IntegerTypeSpec>, Bounds>
       t;
 };
 
@@ -1457,11 +1457,11 @@ struct DataStmtObject {
 // R838 data-stmt-set -> data-stmt-object-list / data-stmt-value-list /
 struct DataStmtSet {
   TUPLE_CLASS_BOILERPLATE(DataStmtSet);
-  std::tuple<std::list<DataStmtObject>, std::list<DataStmtValue>> t;
+  std::tuple<List<DataStmtObject>, List<DataStmtValue>> t;
 };
 
 // R837 data-stmt -> DATA data-stmt-set [[,] data-stmt-set]...
-WRAPPER_CLASS(DataStmt, std::list<DataStmtSet>);
+WRAPPER_CLASS(DataStmt, List<DataStmtSet>);
 
 // R848 dimension-stmt ->
 //        DIMENSION [::] array-name ( array-spec )
@@ -1471,17 +1471,17 @@ struct DimensionStmt {
     TUPLE_CLASS_BOILERPLATE(Declaration);
     std::tuple<Name, ArraySpec> t;
   };
-  WRAPPER_CLASS_BOILERPLATE(DimensionStmt, std::list<Declaration>);
+  WRAPPER_CLASS_BOILERPLATE(DimensionStmt, List<Declaration>);
 };
 
 // R849 intent-stmt -> INTENT ( intent-spec ) [::] dummy-arg-name-list
 struct IntentStmt {
   TUPLE_CLASS_BOILERPLATE(IntentStmt);
-  std::tuple<IntentSpec, std::list<Name>> t;
+  std::tuple<IntentSpec, List<Name>> t;
 };
 
 // R850 optional-stmt -> OPTIONAL [::] dummy-arg-name-list
-WRAPPER_CLASS(OptionalStmt, std::list<Name>);
+WRAPPER_CLASS(OptionalStmt, List<Name>);
 
 // R854 pointer-decl ->
 //        object-name [( deferred-shape-spec-list )] | proc-entity-name
@@ -1491,10 +1491,10 @@ struct PointerDecl {
 };
 
 // R853 pointer-stmt -> POINTER [::] pointer-decl-list
-WRAPPER_CLASS(PointerStmt, std::list<PointerDecl>);
+WRAPPER_CLASS(PointerStmt, List<PointerDecl>);
 
 // R855 protected-stmt -> PROTECTED [::] entity-name-list
-WRAPPER_CLASS(ProtectedStmt, std::list<Name>);
+WRAPPER_CLASS(ProtectedStmt, List<Name>);
 
 // R857 saved-entity -> object-name | proc-pointer-name | / common-block-name /
 // R858 proc-pointer-name -> name
@@ -1505,16 +1505,16 @@ struct SavedEntity {
 };
 
 // R856 save-stmt -> SAVE [[::] saved-entity-list]
-WRAPPER_CLASS(SaveStmt, std::list<SavedEntity>);
+WRAPPER_CLASS(SaveStmt, List<SavedEntity>);
 
 // R859 target-stmt -> TARGET [::] target-decl-list
-WRAPPER_CLASS(TargetStmt, std::list<ObjectDecl>);
+WRAPPER_CLASS(TargetStmt, List<ObjectDecl>);
 
 // R861 value-stmt -> VALUE [::] dummy-arg-name-list
-WRAPPER_CLASS(ValueStmt, std::list<Name>);
+WRAPPER_CLASS(ValueStmt, List<Name>);
 
 // R862 volatile-stmt -> VOLATILE [::] object-name-list
-WRAPPER_CLASS(VolatileStmt, std::list<ObjectName>);
+WRAPPER_CLASS(VolatileStmt, List<ObjectName>);
 
 // R865 letter-spec -> letter [- letter]
 struct LetterSpec {
@@ -1525,7 +1525,7 @@ struct LetterSpec {
 // R864 implicit-spec -> declaration-type-spec ( letter-spec-list )
 struct ImplicitSpec {
   TUPLE_CLASS_BOILERPLATE(ImplicitSpec);
-  std::tuple<DeclarationTypeSpec, std::list<LetterSpec>> t;
+  std::tuple<DeclarationTypeSpec, List<LetterSpec>> t;
 };
 
 // R863 implicit-stmt ->
@@ -1535,7 +1535,7 @@ struct ImplicitSpec {
 struct ImplicitStmt {
   UNION_CLASS_BOILERPLATE(ImplicitStmt);
   ENUM_CLASS(ImplicitNoneNameSpec, External, Type)  // R866
-  std::variant<std::list<ImplicitSpec>, std::list<ImplicitNoneNameSpec>> u;
+  std::variant<List<ImplicitSpec>, List<ImplicitNoneNameSpec>> u;
 };
 
 // R874 common-block-object -> variable-name [( array-spec )]
@@ -1550,12 +1550,12 @@ struct CommonBlockObject {
 struct CommonStmt {
   struct Block {
     TUPLE_CLASS_BOILERPLATE(Block);
-    std::tuple<std::optional<Name>, std::list<CommonBlockObject>> t;
+    std::tuple<std::optional<Name>, List<CommonBlockObject>> t;
   };
   BOILERPLATE(CommonStmt);
-  CommonStmt(std::optional<Name> &&, std::list<CommonBlockObject> &&,
-      std::list<Block> &&);
-  std::list<Block> blocks;
+  CommonStmt(std::optional<Name> &&, List<CommonBlockObject> &&,
+      List<Block> &&);
+  List<Block> blocks;
 };
 
 // R872 equivalence-object -> variable-name | array-element | substring
@@ -1563,7 +1563,7 @@ WRAPPER_CLASS(EquivalenceObject, common::Indirection<Designator>);
 
 // R870 equivalence-stmt -> EQUIVALENCE equivalence-set-list
 // R871 equivalence-set -> ( equivalence-object , equivalence-object-list )
-WRAPPER_CLASS(EquivalenceStmt, std::list<std::list<EquivalenceObject>>);
+WRAPPER_CLASS(EquivalenceStmt, List<List<EquivalenceObject>>);
 
 // R910 substring-range -> [scalar-int-expr] : [scalar-int-expr]
 struct SubstringRange {
@@ -1609,7 +1609,7 @@ struct ImageSelectorSpec {
 //        lbracket cosubscript-list [, image-selector-spec-list] rbracket
 struct ImageSelector {
   TUPLE_CLASS_BOILERPLATE(ImageSelector);
-  std::tuple<std::list<Cosubscript>, std::list<ImageSelectorSpec>> t;
+  std::tuple<List<Cosubscript>, List<ImageSelectorSpec>> t;
 };
 
 // R1001 - R1022 expressions
@@ -1725,19 +1725,19 @@ struct Expr {
 // R912 part-ref -> part-name [( section-subscript-list )] [image-selector]
 struct PartRef {
   BOILERPLATE(PartRef);
-  PartRef(Name &&n, std::list<SectionSubscript> &&ss,
+  PartRef(Name &&n, List<SectionSubscript> &&ss,
       std::optional<ImageSelector> &&is)
     : name{std::move(n)},
       subscripts(std::move(ss)), imageSelector{std::move(is)} {}
   Name name;
-  std::list<SectionSubscript> subscripts;
+  List<SectionSubscript> subscripts;
   std::optional<ImageSelector> imageSelector;
 };
 
 // R911 data-ref -> part-ref [% part-ref]...
 struct DataRef {
   UNION_CLASS_BOILERPLATE(DataRef);
-  explicit DataRef(std::list<PartRef> &&);
+  explicit DataRef(List<PartRef> &&);
   std::variant<Name, common::Indirection<StructureComponent>,
       common::Indirection<ArrayElement>,
       common::Indirection<CoindexedNamedObject>>
@@ -1821,11 +1821,11 @@ struct CoindexedNamedObject {
 // R917 array-element -> data-ref
 struct ArrayElement {
   BOILERPLATE(ArrayElement);
-  ArrayElement(DataRef &&dr, std::list<SectionSubscript> &&ss)
+  ArrayElement(DataRef &&dr, List<SectionSubscript> &&ss)
     : base{std::move(dr)}, subscripts(std::move(ss)) {}
   Substring ConvertToSubstring();
   DataRef base;
-  std::list<SectionSubscript> subscripts;
+  List<SectionSubscript> subscripts;
 };
 
 // R933 allocate-object -> variable-name | structure-component
@@ -1851,7 +1851,7 @@ using AllocateCoshapeSpec = AllocateShapeSpec;
 //      [allocate-coshape-spec-list ,] [lower-bound-expr :] *
 struct AllocateCoarraySpec {
   TUPLE_CLASS_BOILERPLATE(AllocateCoarraySpec);
-  std::tuple<std::list<AllocateCoshapeSpec>, std::optional<BoundExpr>> t;
+  std::tuple<List<AllocateCoshapeSpec>, std::optional<BoundExpr>> t;
 };
 
 // R932 allocation ->
@@ -1859,7 +1859,7 @@ struct AllocateCoarraySpec {
 //        [lbracket allocate-coarray-spec rbracket]
 struct Allocation {
   TUPLE_CLASS_BOILERPLATE(Allocation);
-  std::tuple<AllocateObject, std::list<AllocateShapeSpec>,
+  std::tuple<AllocateObject, List<AllocateShapeSpec>,
       std::optional<AllocateCoarraySpec>>
       t;
 };
@@ -1893,8 +1893,8 @@ struct AllocOpt {
 //        ALLOCATE ( [type-spec ::] allocation-list [, alloc-opt-list] )
 struct AllocateStmt {
   TUPLE_CLASS_BOILERPLATE(AllocateStmt);
-  std::tuple<std::optional<TypeSpec>, std::list<Allocation>,
-      std::list<AllocOpt>>
+  std::tuple<std::optional<TypeSpec>, List<Allocation>,
+      List<AllocOpt>>
       t;
 };
 
@@ -1906,13 +1906,13 @@ struct PointerObject {
 };
 
 // R939 nullify-stmt -> NULLIFY ( pointer-object-list )
-WRAPPER_CLASS(NullifyStmt, std::list<PointerObject>);
+WRAPPER_CLASS(NullifyStmt, List<PointerObject>);
 
 // R941 deallocate-stmt ->
 //        DEALLOCATE ( allocate-object-list [, dealloc-opt-list] )
 struct DeallocateStmt {
   TUPLE_CLASS_BOILERPLATE(DeallocateStmt);
-  std::tuple<std::list<AllocateObject>, std::list<StatOrErrmsg>> t;
+  std::tuple<List<AllocateObject>, List<StatOrErrmsg>> t;
 };
 
 // R1032 assignment-stmt -> variable = expr
@@ -1940,7 +1940,7 @@ struct BoundsRemapping {
 struct PointerAssignmentStmt {
   struct Bounds {
     UNION_CLASS_BOILERPLATE(Bounds);
-    std::variant<std::list<BoundsRemapping>, std::list<BoundsSpec>> u;
+    std::variant<List<BoundsRemapping>, List<BoundsSpec>> u;
   };
   TUPLE_CLASS_BOILERPLATE(PointerAssignmentStmt);
   std::tuple<DataRef, Bounds, Expr> t;
@@ -1989,15 +1989,15 @@ WRAPPER_CLASS(EndWhereStmt, std::optional<Name>);
 struct WhereConstruct {
   struct MaskedElsewhere {
     TUPLE_CLASS_BOILERPLATE(MaskedElsewhere);
-    std::tuple<Statement<MaskedElsewhereStmt>, std::list<WhereBodyConstruct>> t;
+    std::tuple<Statement<MaskedElsewhereStmt>, List<WhereBodyConstruct>> t;
   };
   struct Elsewhere {
     TUPLE_CLASS_BOILERPLATE(Elsewhere);
-    std::tuple<Statement<ElsewhereStmt>, std::list<WhereBodyConstruct>> t;
+    std::tuple<Statement<ElsewhereStmt>, List<WhereBodyConstruct>> t;
   };
   TUPLE_CLASS_BOILERPLATE(WhereConstruct);
-  std::tuple<Statement<WhereConstructStmt>, std::list<WhereBodyConstruct>,
-      std::list<MaskedElsewhere>, std::optional<Elsewhere>,
+  std::tuple<Statement<WhereConstructStmt>, List<WhereBodyConstruct>,
+      List<MaskedElsewhere>, std::optional<Elsewhere>,
       Statement<EndWhereStmt>>
       t;
 };
@@ -2041,13 +2041,13 @@ WRAPPER_CLASS(EndForallStmt, std::optional<Name>);
 //         forall-construct-stmt [forall-body-construct]... end-forall-stmt
 struct ForallConstruct {
   TUPLE_CLASS_BOILERPLATE(ForallConstruct);
-  std::tuple<Statement<ForallConstructStmt>, std::list<ForallBodyConstruct>,
+  std::tuple<Statement<ForallConstructStmt>, List<ForallBodyConstruct>,
       Statement<EndForallStmt>>
       t;
 };
 
 // R1101 block -> [execution-part-construct]...
-using Block = std::list<ExecutionPartConstruct>;
+using Block = List<ExecutionPartConstruct>;
 
 // R1105 selector -> expr | variable
 struct Selector {
@@ -2065,7 +2065,7 @@ struct Association {
 //        [associate-construct-name :] ASSOCIATE ( association-list )
 struct AssociateStmt {
   TUPLE_CLASS_BOILERPLATE(AssociateStmt);
-  std::tuple<std::optional<Name>, std::list<Association>> t;
+  std::tuple<std::optional<Name>, List<Association>> t;
 };
 
 // R1106 end-associate-stmt -> END ASSOCIATE [associate-construct-name]
@@ -2112,8 +2112,8 @@ struct CoarrayAssociation {
 //         ( team-value [, coarray-association-list] [, sync-stat-list] )
 struct ChangeTeamStmt {
   TUPLE_CLASS_BOILERPLATE(ChangeTeamStmt);
-  std::tuple<std::optional<Name>, TeamValue, std::list<CoarrayAssociation>,
-      std::list<StatOrErrmsg>>
+  std::tuple<std::optional<Name>, TeamValue, List<CoarrayAssociation>,
+      List<StatOrErrmsg>>
       t;
 };
 
@@ -2121,7 +2121,7 @@ struct ChangeTeamStmt {
 //         END TEAM [( [sync-stat-list] )] [team-construct-name]
 struct EndChangeTeamStmt {
   TUPLE_CLASS_BOILERPLATE(EndChangeTeamStmt);
-  std::tuple<std::list<StatOrErrmsg>, std::optional<Name>> t;
+  std::tuple<List<StatOrErrmsg>, std::optional<Name>> t;
 };
 
 // R1111 change-team-construct -> change-team-stmt block end-change-team-stmt
@@ -2134,7 +2134,7 @@ struct ChangeTeamConstruct {
 //         [critical-construct-name :] CRITICAL [( [sync-stat-list] )]
 struct CriticalStmt {
   TUPLE_CLASS_BOILERPLATE(CriticalStmt);
-  std::tuple<std::optional<Name>, std::list<StatOrErrmsg>> t;
+  std::tuple<std::optional<Name>, List<StatOrErrmsg>> t;
 };
 
 // R1118 end-critical-stmt -> END CRITICAL [critical-construct-name]
@@ -2161,7 +2161,7 @@ struct ConcurrentControl {
 //         [, scalar-mask-expr] )
 struct ConcurrentHeader {
   TUPLE_CLASS_BOILERPLATE(ConcurrentHeader);
-  std::tuple<std::optional<IntegerTypeSpec>, std::list<ConcurrentControl>,
+  std::tuple<std::optional<IntegerTypeSpec>, List<ConcurrentControl>,
       std::optional<ScalarLogicalExpr>>
       t;
 };
@@ -2171,9 +2171,9 @@ struct ConcurrentHeader {
 //         SHARED ( variable-name-list ) | DEFAULT ( NONE )
 struct LocalitySpec {
   UNION_CLASS_BOILERPLATE(LocalitySpec);
-  WRAPPER_CLASS(Local, std::list<Name>);
-  WRAPPER_CLASS(LocalInit, std::list<Name>);
-  WRAPPER_CLASS(Shared, std::list<Name>);
+  WRAPPER_CLASS(Local, List<Name>);
+  WRAPPER_CLASS(LocalInit, List<Name>);
+  WRAPPER_CLASS(Shared, List<Name>);
   EMPTY_CLASS(DefaultNone);
   std::variant<Local, LocalInit, Shared, DefaultNone> u;
 };
@@ -2188,7 +2188,7 @@ struct LoopControl {
   UNION_CLASS_BOILERPLATE(LoopControl);
   struct Concurrent {
     TUPLE_CLASS_BOILERPLATE(Concurrent);
-    std::tuple<ConcurrentHeader, std::list<LocalitySpec>> t;
+    std::tuple<ConcurrentHeader, List<LocalitySpec>> t;
   };
   using Bounds = LoopBounds<ScalarName, ScalarExpr>;
   std::variant<Bounds, ScalarLogicalExpr, Concurrent> u;
@@ -2259,7 +2259,7 @@ struct IfConstruct {
     std::tuple<Statement<ElseStmt>, Block> t;
   };
   TUPLE_CLASS_BOILERPLATE(IfConstruct);
-  std::tuple<Statement<IfThenStmt>, Block, std::list<ElseIfBlock>,
+  std::tuple<Statement<IfThenStmt>, Block, List<ElseIfBlock>,
       std::optional<ElseBlock>, Statement<EndIfStmt>>
       t;
 };
@@ -2298,7 +2298,7 @@ EMPTY_CLASS(Default);
 
 struct CaseSelector {
   UNION_CLASS_BOILERPLATE(CaseSelector);
-  std::variant<std::list<CaseValueRange>, Default> u;
+  std::variant<List<CaseValueRange>, Default> u;
 };
 
 // R1142 case-stmt -> CASE case-selector [case-construct-name]
@@ -2320,7 +2320,7 @@ struct CaseConstruct {
     std::tuple<Statement<CaseStmt>, Block> t;
   };
   TUPLE_CLASS_BOILERPLATE(CaseConstruct);
-  std::tuple<Statement<SelectCaseStmt>, std::list<Case>,
+  std::tuple<Statement<SelectCaseStmt>, List<Case>,
       Statement<EndSelectStmt>>
       t;
 };
@@ -2355,7 +2355,7 @@ struct SelectRankConstruct {
     TUPLE_CLASS_BOILERPLATE(RankCase);
     std::tuple<Statement<SelectRankCaseStmt>, Block> t;
   };
-  std::tuple<Statement<SelectRankStmt>, std::list<RankCase>,
+  std::tuple<Statement<SelectRankStmt>, List<RankCase>,
       Statement<EndSelectStmt>>
       t;
 };
@@ -2389,7 +2389,7 @@ struct SelectTypeConstruct {
     TUPLE_CLASS_BOILERPLATE(TypeCase);
     std::tuple<Statement<TypeGuardStmt>, Block> t;
   };
-  std::tuple<Statement<SelectTypeStmt>, std::list<TypeCase>,
+  std::tuple<Statement<SelectTypeStmt>, List<TypeCase>,
       Statement<EndSelectStmt>>
       t;
 };
@@ -2403,7 +2403,7 @@ WRAPPER_CLASS(GotoStmt, Label);
 // R1158 computed-goto-stmt -> GO TO ( label-list ) [,] scalar-int-expr
 struct ComputedGotoStmt {
   TUPLE_CLASS_BOILERPLATE(ComputedGotoStmt);
-  std::tuple<std::list<Label>, ScalarIntExpr> t;
+  std::tuple<List<Label>, ScalarIntExpr> t;
 };
 
 // R1162 stop-code -> scalar-default-char-expr | scalar-int-expr
@@ -2422,7 +2422,7 @@ struct StopStmt {
 };
 
 // R1164 sync-all-stmt -> SYNC ALL [( [sync-stat-list] )]
-WRAPPER_CLASS(SyncAllStmt, std::list<StatOrErrmsg>);
+WRAPPER_CLASS(SyncAllStmt, List<StatOrErrmsg>);
 
 // R1166 sync-images-stmt -> SYNC IMAGES ( image-set [, sync-stat-list] )
 // R1167 image-set -> int-expr | *
@@ -2432,16 +2432,16 @@ struct SyncImagesStmt {
     std::variant<IntExpr, Star> u;
   };
   TUPLE_CLASS_BOILERPLATE(SyncImagesStmt);
-  std::tuple<ImageSet, std::list<StatOrErrmsg>> t;
+  std::tuple<ImageSet, List<StatOrErrmsg>> t;
 };
 
 // R1168 sync-memory-stmt -> SYNC MEMORY [( [sync-stat-list] )]
-WRAPPER_CLASS(SyncMemoryStmt, std::list<StatOrErrmsg>);
+WRAPPER_CLASS(SyncMemoryStmt, List<StatOrErrmsg>);
 
 // R1169 sync-team-stmt -> SYNC TEAM ( team-value [, sync-stat-list] )
 struct SyncTeamStmt {
   TUPLE_CLASS_BOILERPLATE(SyncTeamStmt);
-  std::tuple<TeamValue, std::list<StatOrErrmsg>> t;
+  std::tuple<TeamValue, List<StatOrErrmsg>> t;
 };
 
 // R1171 event-variable -> scalar-variable
@@ -2450,7 +2450,7 @@ using EventVariable = Scalar<Variable>;
 // R1170 event-post-stmt -> EVENT POST ( event-variable [, sync-stat-list] )
 struct EventPostStmt {
   TUPLE_CLASS_BOILERPLATE(EventPostStmt);
-  std::tuple<EventVariable, std::list<StatOrErrmsg>> t;
+  std::tuple<EventVariable, List<StatOrErrmsg>> t;
 };
 
 // R1172 event-wait-stmt ->
@@ -2463,7 +2463,7 @@ struct EventWaitStmt {
     std::variant<ScalarIntExpr, StatOrErrmsg> u;
   };
   TUPLE_CLASS_BOILERPLATE(EventWaitStmt);
-  std::tuple<EventVariable, std::list<EventWaitSpec>> t;
+  std::tuple<EventVariable, List<EventWaitSpec>> t;
 };
 
 // R1177 team-variable -> scalar-variable
@@ -2479,7 +2479,7 @@ struct FormTeamStmt {
     std::variant<ScalarIntExpr, StatOrErrmsg> u;
   };
   TUPLE_CLASS_BOILERPLATE(FormTeamStmt);
-  std::tuple<ScalarIntExpr, TeamVariable, std::list<FormTeamSpec>> t;
+  std::tuple<ScalarIntExpr, TeamVariable, List<FormTeamSpec>> t;
 };
 
 // R1182 lock-variable -> scalar-variable
@@ -2493,13 +2493,13 @@ struct LockStmt {
     std::variant<Scalar<Logical<Variable>>, StatOrErrmsg> u;
   };
   TUPLE_CLASS_BOILERPLATE(LockStmt);
-  std::tuple<LockVariable, std::list<LockStat>> t;
+  std::tuple<LockVariable, List<LockStat>> t;
 };
 
 // R1181 unlock-stmt -> UNLOCK ( lock-variable [, sync-stat-list] )
 struct UnlockStmt {
   TUPLE_CLASS_BOILERPLATE(UnlockStmt);
-  std::tuple<LockVariable, std::list<StatOrErrmsg>> t;
+  std::tuple<LockVariable, List<StatOrErrmsg>> t;
 };
 
 // R1202 file-unit-number -> scalar-int-expr
@@ -2556,7 +2556,7 @@ struct ConnectSpec {
 };
 
 // R1204 open-stmt -> OPEN ( connect-spec-list )
-WRAPPER_CLASS(OpenStmt, std::list<ConnectSpec>);
+WRAPPER_CLASS(OpenStmt, List<ConnectSpec>);
 
 // R1208 close-stmt -> CLOSE ( close-spec-list )
 // R1209 close-spec ->
@@ -2570,7 +2570,7 @@ struct CloseStmt {
         StatusExpr>
         u;
   };
-  WRAPPER_CLASS_BOILERPLATE(CloseStmt, std::list<CloseSpec>);
+  WRAPPER_CLASS_BOILERPLATE(CloseStmt, List<CloseSpec>);
 };
 
 // R1215 format -> default-char-expr | label | *
@@ -2624,7 +2624,7 @@ struct InputItem {
 struct ReadStmt {
   BOILERPLATE(ReadStmt);
   ReadStmt(std::optional<IoUnit> &&i, std::optional<Format> &&f,
-      std::list<IoControlSpec> &&cs, std::list<InputItem> &&its)
+      List<IoControlSpec> &&cs, List<InputItem> &&its)
     : iounit{std::move(i)}, format{std::move(f)}, controls(std::move(cs)),
       items(std::move(its)) {}
   std::optional<IoUnit> iounit;  // if first in controls without UNIT= &/or
@@ -2632,8 +2632,8 @@ struct ReadStmt {
   std::optional<Format> format;  // if second in controls without FMT=/NML=, or
                                  // no (io-control-spec-list); might be
                                  // an untagged namelist group name
-  std::list<IoControlSpec> controls;
-  std::list<InputItem> items;
+  List<IoControlSpec> controls;
+  List<InputItem> items;
 };
 
 // R1217 output-item -> expr | io-implied-do
@@ -2646,21 +2646,21 @@ struct OutputItem {
 struct WriteStmt {
   BOILERPLATE(WriteStmt);
   WriteStmt(std::optional<IoUnit> &&i, std::optional<Format> &&f,
-      std::list<IoControlSpec> &&cs, std::list<OutputItem> &&its)
+      List<IoControlSpec> &&cs, List<OutputItem> &&its)
     : iounit{std::move(i)}, format{std::move(f)}, controls(std::move(cs)),
       items(std::move(its)) {}
   std::optional<IoUnit> iounit;  // if first in controls without UNIT= &/or
                                  // followed by untagged format/namelist
   std::optional<Format> format;  // if second in controls without FMT=/NML=;
                                  // might be an untagged namelist group, too
-  std::list<IoControlSpec> controls;
-  std::list<OutputItem> items;
+  List<IoControlSpec> controls;
+  List<OutputItem> items;
 };
 
 // R1212 print-stmt PRINT format [, output-item-list]
 struct PrintStmt {
   TUPLE_CLASS_BOILERPLATE(PrintStmt);
-  std::tuple<Format, std::list<OutputItem>> t;
+  std::tuple<Format, List<OutputItem>> t;
 };
 
 // R1220 io-implied-do-control ->
@@ -2671,12 +2671,12 @@ using IoImpliedDoControl = LoopBounds<DoVariable, ScalarIntExpr>;
 // R1219 io-implied-do-object -> input-item | output-item
 struct InputImpliedDo {
   TUPLE_CLASS_BOILERPLATE(InputImpliedDo);
-  std::tuple<std::list<InputItem>, IoImpliedDoControl> t;
+  std::tuple<List<InputItem>, IoImpliedDoControl> t;
 };
 
 struct OutputImpliedDo {
   TUPLE_CLASS_BOILERPLATE(OutputImpliedDo);
-  std::tuple<std::list<OutputItem>, IoImpliedDoControl> t;
+  std::tuple<List<OutputItem>, IoImpliedDoControl> t;
 };
 
 // R1223 wait-spec ->
@@ -2692,7 +2692,7 @@ struct WaitSpec {
 };
 
 // R1222 wait-stmt -> WAIT ( wait-spec-list )
-WRAPPER_CLASS(WaitStmt, std::list<WaitSpec>);
+WRAPPER_CLASS(WaitStmt, List<WaitSpec>);
 
 // R1227 position-spec ->
 //         [UNIT =] file-unit-number | IOMSG = iomsg-variable |
@@ -2707,17 +2707,17 @@ struct PositionOrFlushSpec {
 
 // R1224 backspace-stmt ->
 //         BACKSPACE file-unit-number | BACKSPACE ( position-spec-list )
-WRAPPER_CLASS(BackspaceStmt, std::list<PositionOrFlushSpec>);
+WRAPPER_CLASS(BackspaceStmt, List<PositionOrFlushSpec>);
 
 // R1225 endfile-stmt ->
 //         ENDFILE file-unit-number | ENDFILE ( position-spec-list )
-WRAPPER_CLASS(EndfileStmt, std::list<PositionOrFlushSpec>);
+WRAPPER_CLASS(EndfileStmt, List<PositionOrFlushSpec>);
 
 // R1226 rewind-stmt -> REWIND file-unit-number | REWIND ( position-spec-list )
-WRAPPER_CLASS(RewindStmt, std::list<PositionOrFlushSpec>);
+WRAPPER_CLASS(RewindStmt, List<PositionOrFlushSpec>);
 
 // R1228 flush-stmt -> FLUSH file-unit-number | FLUSH ( flush-spec-list )
-WRAPPER_CLASS(FlushStmt, std::list<PositionOrFlushSpec>);
+WRAPPER_CLASS(FlushStmt, List<PositionOrFlushSpec>);
 
 // R1231 inquire-spec ->
 //         [UNIT =] file-unit-number | FILE = file-name-expr |
@@ -2785,9 +2785,9 @@ struct InquireStmt {
   UNION_CLASS_BOILERPLATE(InquireStmt);
   struct Iolength {
     TUPLE_CLASS_BOILERPLATE(Iolength);
-    std::tuple<ScalarIntVariable, std::list<OutputItem>> t;
+    std::tuple<ScalarIntVariable, List<OutputItem>> t;
   };
-  std::variant<std::list<InquireSpec>, Iolength> u;
+  std::variant<List<InquireSpec>, Iolength> u;
 };
 
 // R1301 format-stmt -> FORMAT format-specification
@@ -2827,7 +2827,7 @@ struct ModuleSubprogram {
 // R1407 module-subprogram-part -> contains-stmt [module-subprogram]...
 struct ModuleSubprogramPart {
   TUPLE_CLASS_BOILERPLATE(ModuleSubprogramPart);
-  std::tuple<Statement<ContainsStmt>, std::list<ModuleSubprogram>> t;
+  std::tuple<Statement<ContainsStmt>, List<ModuleSubprogram>> t;
 };
 
 // R1406 end-module-stmt -> END [MODULE [module-name]]
@@ -2922,7 +2922,7 @@ struct GenericSpec {
 //         GENERIC [, access-spec] :: generic-spec => specific-procedure-list
 struct GenericStmt {
   TUPLE_CLASS_BOILERPLATE(GenericStmt);
-  std::tuple<std::optional<AccessSpec>, GenericSpec, std::list<Name>> t;
+  std::tuple<std::optional<AccessSpec>, GenericSpec, List<Name>> t;
 };
 
 // R1503 interface-stmt -> INTERFACE [generic-spec] | ABSTRACT INTERFACE
@@ -2949,11 +2949,11 @@ struct UseStmt {
   BOILERPLATE(UseStmt);
   ENUM_CLASS(ModuleNature, Intrinsic, Non_Intrinsic)  // R1410
   template<typename A>
-  UseStmt(std::optional<ModuleNature> &&nat, Name &&n, std::list<A> &&x)
+  UseStmt(std::optional<ModuleNature> &&nat, Name &&n, List<A> &&x)
     : nature(std::move(nat)), moduleName(std::move(n)), u(std::move(x)) {}
   std::optional<ModuleNature> nature;
   Name moduleName;
-  std::variant<std::list<Rename>, std::list<Only>> u;
+  std::variant<List<Rename>, List<Only>> u;
 };
 
 // R1514 proc-attr-spec ->
@@ -2971,8 +2971,8 @@ struct ProcAttrSpec {
 //         proc-decl-list
 struct ProcedureDeclarationStmt {
   TUPLE_CLASS_BOILERPLATE(ProcedureDeclarationStmt);
-  std::tuple<std::optional<ProcInterface>, std::list<ProcAttrSpec>,
-      std::list<ProcDecl>>
+  std::tuple<std::optional<ProcInterface>, List<ProcAttrSpec>,
+      List<ProcDecl>>
       t;
 };
 
@@ -3011,7 +3011,7 @@ struct Suffix {
 // R1531 dummy-arg-name -> name
 struct FunctionStmt {
   TUPLE_CLASS_BOILERPLATE(FunctionStmt);
-  std::tuple<std::list<PrefixSpec>, Name, std::list<Name>,
+  std::tuple<List<PrefixSpec>, Name, List<Name>,
       std::optional<Suffix>>
       t;
 };
@@ -3030,7 +3030,7 @@ struct DummyArg {
 //         [proc-language-binding-spec]]
 struct SubroutineStmt {
   TUPLE_CLASS_BOILERPLATE(SubroutineStmt);
-  std::tuple<std::list<PrefixSpec>, Name, std::list<DummyArg>,
+  std::tuple<List<PrefixSpec>, Name, List<DummyArg>,
       std::optional<LanguageBindingSpec>>
       t;
 };
@@ -3062,7 +3062,7 @@ struct InterfaceBody {
 struct ProcedureStmt {
   ENUM_CLASS(Kind, ModuleProcedure, Procedure)
   TUPLE_CLASS_BOILERPLATE(ProcedureStmt);
-  std::tuple<Kind, std::list<Name>> t;
+  std::tuple<Kind, List<Name>> t;
 };
 
 // R1502 interface-specification -> interface-body | procedure-stmt
@@ -3078,16 +3078,16 @@ WRAPPER_CLASS(EndInterfaceStmt, std::optional<GenericSpec>);
 //         interface-stmt [interface-specification]... end-interface-stmt
 struct InterfaceBlock {
   TUPLE_CLASS_BOILERPLATE(InterfaceBlock);
-  std::tuple<Statement<InterfaceStmt>, std::list<InterfaceSpecification>,
+  std::tuple<Statement<InterfaceStmt>, List<InterfaceSpecification>,
       Statement<EndInterfaceStmt>>
       t;
 };
 
 // R1511 external-stmt -> EXTERNAL [::] external-name-list
-WRAPPER_CLASS(ExternalStmt, std::list<Name>);
+WRAPPER_CLASS(ExternalStmt, List<Name>);
 
 // R1519 intrinsic-stmt -> INTRINSIC [::] intrinsic-procedure-name-list
-WRAPPER_CLASS(IntrinsicStmt, std::list<Name>);
+WRAPPER_CLASS(IntrinsicStmt, List<Name>);
 
 // R1522 procedure-designator ->
 //         procedure-name | proc-component-ref | data-ref % binding-name
@@ -3121,7 +3121,7 @@ struct ActualArgSpec {
 struct Call {
   TUPLE_CLASS_BOILERPLATE(Call);
   CharBlock source;
-  std::tuple<ProcedureDesignator, std::list<ActualArgSpec>> t;
+  std::tuple<ProcedureDesignator, List<ActualArgSpec>> t;
 };
 
 struct FunctionReference {
@@ -3173,7 +3173,7 @@ struct SeparateModuleSubprogram {
 // R1541 entry-stmt -> ENTRY entry-name [( [dummy-arg-list] ) [suffix]]
 struct EntryStmt {
   TUPLE_CLASS_BOILERPLATE(EntryStmt);
-  std::tuple<Name, std::list<DummyArg>, std::optional<Suffix>> t;
+  std::tuple<Name, List<DummyArg>, std::optional<Suffix>> t;
 };
 
 // R1542 return-stmt -> RETURN [scalar-int-expr]
@@ -3183,7 +3183,7 @@ WRAPPER_CLASS(ReturnStmt, std::optional<ScalarIntExpr>);
 //         function-name ( [dummy-arg-name-list] ) = scalar-expr
 struct StmtFunctionStmt {
   TUPLE_CLASS_BOILERPLATE(StmtFunctionStmt);
-  std::tuple<Name, std::list<Name>, Scalar<Expr>> t;
+  std::tuple<Name, List<Name>, Scalar<Expr>> t;
   Statement<ActionStmt> ConvertToAssignment();
 };
 
@@ -3194,10 +3194,10 @@ struct CompilerDirective {
   UNION_CLASS_BOILERPLATE(CompilerDirective);
   struct IgnoreTKR {
     TUPLE_CLASS_BOILERPLATE(IgnoreTKR);
-    std::tuple<std::list<const char *>, Name> t;
+    std::tuple<List<const char *>, Name> t;
   };
   CharBlock source;
-  std::variant<std::list<IgnoreTKR>, std::list<Name>> u;
+  std::variant<List<IgnoreTKR>, List<Name>> u;
 };
 
 // Legacy extensions
@@ -3205,7 +3205,7 @@ struct BasedPointer {
   TUPLE_CLASS_BOILERPLATE(BasedPointer);
   std::tuple<ObjectName, ObjectName, std::optional<ArraySpec>> t;
 };
-WRAPPER_CLASS(BasedPointerStmt, std::list<BasedPointer>);
+WRAPPER_CLASS(BasedPointerStmt, List<BasedPointer>);
 
 struct Union;
 struct StructureDef;
@@ -3221,7 +3221,7 @@ struct Map {
   EMPTY_CLASS(MapStmt);
   EMPTY_CLASS(EndMapStmt);
   TUPLE_CLASS_BOILERPLATE(Map);
-  std::tuple<Statement<MapStmt>, std::list<StructureField>,
+  std::tuple<Statement<MapStmt>, List<StructureField>,
       Statement<EndMapStmt>>
       t;
 };
@@ -3230,25 +3230,25 @@ struct Union {
   EMPTY_CLASS(UnionStmt);
   EMPTY_CLASS(EndUnionStmt);
   TUPLE_CLASS_BOILERPLATE(Union);
-  std::tuple<Statement<UnionStmt>, std::list<Map>, Statement<EndUnionStmt>> t;
+  std::tuple<Statement<UnionStmt>, List<Map>, Statement<EndUnionStmt>> t;
 };
 
 struct StructureStmt {
   TUPLE_CLASS_BOILERPLATE(StructureStmt);
-  std::tuple<Name, bool /*slashes*/, std::list<EntityDecl>> t;
+  std::tuple<Name, bool /*slashes*/, List<EntityDecl>> t;
 };
 
 struct StructureDef {
   EMPTY_CLASS(EndStructureStmt);
   TUPLE_CLASS_BOILERPLATE(StructureDef);
-  std::tuple<Statement<StructureStmt>, std::list<StructureField>,
+  std::tuple<Statement<StructureStmt>, List<StructureField>,
       Statement<EndStructureStmt>>
       t;
 };
 
 // Old style PARAMETER statement without parentheses.
 // Types are determined entirely from the right-hand sides, not the names.
-WRAPPER_CLASS(OldParameterStmt, std::list<NamedConstantDef>);
+WRAPPER_CLASS(OldParameterStmt, List<NamedConstantDef>);
 
 // Deprecations
 struct ArithmeticIfStmt {
@@ -3263,7 +3263,7 @@ struct AssignStmt {
 
 struct AssignedGotoStmt {
   TUPLE_CLASS_BOILERPLATE(AssignedGotoStmt);
-  std::tuple<Name, std::list<Label>> t;
+  std::tuple<Name, List<Label>> t;
 };
 
 WRAPPER_CLASS(PauseStmt, std::optional<StopCode>);
@@ -3291,7 +3291,7 @@ struct OmpObject {
   std::variant<Designator, /*common block*/ Name> u;
 };
 
-WRAPPER_CLASS(OmpObjectList, std::list<OmpObject>);
+WRAPPER_CLASS(OmpObjectList, List<OmpObject>);
 
 // 2.15.5.1 map-type -> TO | FROM | TOFROM | ALLOC | RELEASE | DELETE
 struct OmpMapType {
@@ -3349,7 +3349,7 @@ struct OmpIfClause {
 // 2.8.1 aligned-clause -> ALIGNED (variable-name-list[ : scalar-constant])
 struct OmpAlignedClause {
   TUPLE_CLASS_BOILERPLATE(OmpAlignedClause);
-  std::tuple<std::list<Name>, std::optional<ScalarIntConstantExpr>> t;
+  std::tuple<List<Name>, std::optional<ScalarIntConstantExpr>> t;
 };
 
 // 2.15.3.7 linear-modifier -> REF | VAL | UVAL
@@ -3364,19 +3364,19 @@ struct OmpLinearClause {
   UNION_CLASS_BOILERPLATE(OmpLinearClause);
   struct WithModifier {
     BOILERPLATE(WithModifier);
-    WithModifier(OmpLinearModifier &&m, std::list<Name> &&n,
+    WithModifier(OmpLinearModifier &&m, List<Name> &&n,
         std::optional<ScalarIntConstantExpr> &&s)
       : modifier(std::move(m)), names(std::move(n)), step(std::move(s)) {}
     OmpLinearModifier modifier;
-    std::list<Name> names;
+    List<Name> names;
     std::optional<ScalarIntConstantExpr> step;
   };
   struct WithoutModifier {
     BOILERPLATE(WithoutModifier);
     WithoutModifier(
-        std::list<Name> &&n, std::optional<ScalarIntConstantExpr> &&s)
+        List<Name> &&n, std::optional<ScalarIntConstantExpr> &&s)
       : names(std::move(n)), step(std::move(s)) {}
-    std::list<Name> names;
+    List<Name> names;
     std::optional<ScalarIntConstantExpr> step;
   };
   std::variant<WithModifier, WithoutModifier> u;
@@ -3393,7 +3393,7 @@ struct OmpReductionOperator {
 //                                         variable-name-list)
 struct OmpReductionClause {
   TUPLE_CLASS_BOILERPLATE(OmpReductionClause);
-  std::tuple<OmpReductionOperator, std::list<Designator>> t;
+  std::tuple<OmpReductionOperator, List<Designator>> t;
 };
 
 // 2.13.9 depend-vec-length -> +/- non-negative-constant
@@ -3419,10 +3419,10 @@ struct OmpDependenceType {
 struct OmpDependClause {
   UNION_CLASS_BOILERPLATE(OmpDependClause);
   EMPTY_CLASS(Source);
-  WRAPPER_CLASS(Sink, std::list<OmpDependSinkVec>);
+  WRAPPER_CLASS(Sink, List<OmpDependSinkVec>);
   struct InOut {
     TUPLE_CLASS_BOILERPLATE(InOut);
-    std::tuple<OmpDependenceType, std::list<Designator>> t;
+    std::tuple<OmpDependenceType, List<Designator>> t;
   };
   std::variant<Source, Sink, InOut> u;
 };
@@ -3449,7 +3449,7 @@ struct OmpClause {
   WRAPPER_CLASS(Firstprivate, OmpObjectList);
   WRAPPER_CLASS(From, OmpObjectList);
   WRAPPER_CLASS(Grainsize, ScalarIntExpr);
-  WRAPPER_CLASS(IsDevicePtr, std::list<Name>);
+  WRAPPER_CLASS(IsDevicePtr, List<Name>);
   WRAPPER_CLASS(Lastprivate, OmpObjectList);
   WRAPPER_CLASS(Link, OmpObjectList);
   WRAPPER_CLASS(NumTasks, ScalarIntExpr);
@@ -3463,8 +3463,8 @@ struct OmpClause {
   WRAPPER_CLASS(Simdlen, ScalarIntConstantExpr);
   WRAPPER_CLASS(ThreadLimit, ScalarIntExpr);
   WRAPPER_CLASS(To, OmpObjectList);
-  WRAPPER_CLASS(Uniform, std::list<Name>);
-  WRAPPER_CLASS(UseDevicePtr, std::list<Name>);
+  WRAPPER_CLASS(Uniform, List<Name>);
+  WRAPPER_CLASS(UseDevicePtr, List<Name>);
   CharBlock source;
   std::variant<Inbranch, Mergeable, Nogroup, Notinbranch, OmpNowait, Untied,
       Threads, Simd, Collapse, Copyin, Copyprivate, Device, DistSchedule, Final,
@@ -3478,7 +3478,7 @@ struct OmpClause {
 };
 
 struct OmpClauseList {
-  WRAPPER_CLASS_BOILERPLATE(OmpClauseList, std::list<OmpClause>);
+  WRAPPER_CLASS_BOILERPLATE(OmpClauseList, List<OmpClause>);
   CharBlock source;
 };
 
@@ -3504,7 +3504,7 @@ struct OmpEndSectionsDirective {
 // [!$omp section
 //    structured-block]
 // ...
-WRAPPER_CLASS(OmpSectionBlocks, std::list<Block>);
+WRAPPER_CLASS(OmpSectionBlocks, List<Block>);
 
 struct OpenMPSectionsConstruct {
   TUPLE_CLASS_BOILERPLATE(OpenMPSectionsConstruct);
@@ -3559,7 +3559,7 @@ WRAPPER_CLASS(OmpReductionInitializerClause, Expr);
 struct OpenMPDeclareReductionConstruct {
   TUPLE_CLASS_BOILERPLATE(OpenMPDeclareReductionConstruct);
   CharBlock source;
-  std::tuple<Verbatim, OmpReductionOperator, std::list<DeclarationTypeSpec>,
+  std::tuple<Verbatim, OmpReductionOperator, List<DeclarationTypeSpec>,
       OmpReductionCombiner, std::optional<OmpReductionInitializerClause>>
       t;
 };
@@ -3618,8 +3618,8 @@ struct OmpMemoryClause {
   CharBlock source;
 };
 
-WRAPPER_CLASS(OmpMemoryClauseList, std::list<OmpMemoryClause>);
-WRAPPER_CLASS(OmpMemoryClausePostList, std::list<OmpMemoryClause>);
+WRAPPER_CLASS(OmpMemoryClauseList, List<OmpMemoryClause>);
+WRAPPER_CLASS(OmpMemoryClausePostList, List<OmpMemoryClause>);
 
 // ATOMIC READ
 struct OmpAtomicRead {
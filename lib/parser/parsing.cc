@@ -13,15 +13,31 @@
 // limitations under the License.
 
 #include "parsing.h"
+#include "binary-parse-tree.h"
 #include "grammar.h"
 #include "instrumented-parser.h"
 #include "message.h"
+#include "module-dependencies.h"
 #include "openmp-grammar.h"
 #include "preprocessor.h"
 #include "prescan.h"
 #include "provenance.h"
 #include "source.h"
+#include "../common/fingerprint.h"
+#include "../common/time-report.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fcntl.h>
+#include <list>
+#include <map>
 #include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
 
 namespace Fortran::parser {
 
@@ -31,6 +47,7 @@ Parsing::~Parsing() {}
 const SourceFile *Parsing::Prescan(const std::string &path, Options options) {
   options_ = options;
   AllSources &allSources{cooked_.allSources()};
+  Provenance start{allSources.range().NextAfter()};
   if (options.isModuleFile) {
     for (const auto &path : options.searchDirectories) {
       allSources.PushSearchPathDirectory(path);
@@ -39,10 +56,13 @@ const SourceFile *Parsing::Prescan(const std::string &path, Options options) {
 
   std::stringstream fileError;
   const SourceFile *sourceFile;
-  if (path == "-") {
-    sourceFile = allSources.ReadStandardInput(&fileError);
-  } else {
-    sourceFile = allSources.Open(path, &fileError);
+  {
+    common::TimeReport::Phase phase{options.timeReport, "Read source file"};
+    if (path == "-") {
+      sourceFile = allSources.ReadStandardInput(&fileError);
+    } else {
+      sourceFile = allSources.Open(path, &fileError);
+    }
   }
   if (!fileError.str().empty()) {
     ProvenanceRange range{allSources.AddCompilerInsertion(path)};
@@ -84,14 +104,332 @@ const SourceFile *Parsing::Prescan(const std::string &path, Options options) {
   }
   ProvenanceRange range{allSources.AddIncludedFile(
       *sourceFile, ProvenanceRange{}, options.isModuleFile)};
-  prescanner.Prescan(range);
-  cooked_.Marshal();
+  common::TimeReport::Measure(
+      options.timeReport, "Prescan", [&]() { prescanner.Prescan(range); });
+  common::TimeReport::Measure(
+      options.timeReport, "Marshal", [&]() { cooked_.Marshal(); });
   if (options.needProvenanceRangeToCharBlockMappings) {
     cooked_.CompileProvenanceRangeToOffsetMappings();
   }
+  prescanned_ = {start, allSources.range().NextAfter() - start};
+  return sourceFile;
+}
+
+// A saved parse tree file begins with a version line and a fingerprint
+// of the rest of its contents.  The rest begins with the settings that
+// affect prescanning and the paths and fingerprints of the source files
+// that were read.  Then come the origins that Prescan() added, in order,
+// with their provenances relative to the first of them; the provenance
+// map of the cooked characters; the cooked characters; and the tree.
+// Single-character compiler insertions that Prescan() reused from earlier
+// in the compilation are recorded by their characters.
+static const std::string parseTreeFileVersion{
+    "f18 parse tree 1 " __DATE__ " " __TIME__ "\n"};
+static constexpr std::size_t fingerprintChars{32};
+
+static std::string ParseTreeSettings(const Options &options) {
+  std::stringstream settings;
+  settings << options.isFixedForm << ' ' << options.fixedFormColumns << ' '
+           << options.isModuleFile << '\n';
+  for (std::size_t j{0}; j < common::LanguageFeature_enumSize; ++j) {
+    auto feature{static_cast<LanguageFeature>(j)};
+    settings << options.features.IsEnabled(feature)
+             << options.features.ShouldWarn(feature);
+  }
+  settings << '\n';
+  for (const auto &path : options.searchDirectories) {
+    settings << "-I" << path << '\n';
+  }
+  for (const auto &predef : options.predefinitions) {
+    if (predef.second) {
+      settings << "-D" << predef.first << '=' << *predef.second << '\n';
+    } else {
+      settings << "-U" << predef.first << '\n';
+    }
+  }
+  return settings.str();
+}
+
+static std::string SourceFingerprint(const SourceFile &source) {
+  return common::Fingerprint{}
+      .Add(std::string_view{source.content(), source.bytes()})
+      .ToString();
+}
+
+std::string ParseTreeFileName(const std::string &directory,
+    const std::string &path, const Options &options) {
+  common::Fingerprint fingerprint;
+  fingerprint.Add(path).Add(ParseTreeSettings(options));
+  return directory + '/' + fingerprint.ToString() + ".tree";
+}
+
+bool Parsing::SaveParseTree(const std::string &file) const {
+  if (!parseTree_ || !consumedWholeFile_ || !messages_.empty() ||
+      prescanned_.empty()) {
+    return false;
+  }
+  common::TimeReport::Phase phase{options_.timeReport, "Save parse tree"};
+  const AllSources &allSources{cooked_.allSources()};
+  std::vector<const SourceFile *> sources;
+  std::string insertions;
+  BinaryEncoder body;
+  auto putRange{[&](ProvenanceRange range) {
+    if (range.empty()) {
+      body.PutUnsigned(0);
+    } else if (prescanned_.Contains(range)) {
+      body.PutUnsigned(1);
+      body.PutUnsigned(range.start() - prescanned_.start());
+      body.PutUnsigned(range.size());
+    } else {
+      auto origin{allSources.DescribeOrigin(range.start())};
+      if (origin.covers != range || origin.source ||
+          !origin.definition.empty() || !origin.replaces.empty() ||
+          origin.text.size() != 1) {
+        return false;
+      }
+      if (insertions.find(origin.text[0]) == std::string::npos) {
+        insertions += origin.text[0];
+      }
+      body.PutUnsigned(2);
+      body.PutUnsigned(static_cast<unsigned char>(origin.text[0]));
+    }
+    return true;
+  }};
+  std::vector<AllSources::OriginDescription> origins;
+  for (Provenance at{prescanned_.start()}; prescanned_.Contains(at);
+       at = origins.back().covers.NextAfter()) {
+    origins.emplace_back(allSources.DescribeOrigin(at));
+  }
+  body.PutUnsigned(prescanned_.size());
+  body.PutUnsigned(origins.size());
+  for (const auto &origin : origins) {
+    if (origin.source) {
+      auto iter{std::find(sources.begin(), sources.end(), origin.source)};
+      body.PutUnsigned(0);
+      body.PutUnsigned(iter - sources.begin());
+      body.PutUnsigned(origin.isModule);
+      if (iter == sources.end()) {
+        sources.push_back(origin.source);
+      }
+      if (!putRange(origin.replaces)) {
+        return false;
+      }
+    } else if (!origin.definition.empty()) {
+      body.PutUnsigned(1);
+      if (!putRange(origin.definition) || !putRange(origin.replaces)) {
+        return false;
+      }
+      body.PutString(origin.text);
+    } else {
+      body.PutUnsigned(2);
+      body.PutString(origin.text);
+    }
+  }
+  const OffsetToProvenanceMappings &map{cooked_.provenanceMap()};
+  std::vector<ProvenanceRange> pieces;
+  for (std::size_t at{0}; at < map.SizeInBytes();) {
+    ProvenanceRange range{map.Map(at)};
+    at += range.size();
+    if (prescanned_.Contains(range)) {
+      pieces.push_back(range);
+    } else {
+      for (std::size_t j{0}; j < range.size(); ++j) {
+        pieces.push_back(range.Suffix(j).Prefix(1));
+      }
+    }
+  }
+  body.PutUnsigned(pieces.size());
+  for (ProvenanceRange range : pieces) {
+    if (!putRange(range)) {
+      return false;
+    }
+  }
+  body.PutString(cooked_.data());
+  if (!EncodeParseTree(body, *parseTree_, cooked_)) {
+    return false;
+  }
+  // The primary source file was the first to be included.
+  if (sources.empty()) {
+    return false;
+  }
+  BinaryEncoder out;
+  out.PutString(ParseTreeSettings(options_));
+  out.PutUnsigned(static_cast<int>(allSources.encoding()));
+  out.PutUnsigned(sources.size());
+  for (const SourceFile *source : sources) {
+    out.PutString(source->path());
+    out.PutUnsigned(source->bytes());
+    out.PutString(SourceFingerprint(*source));
+  }
+  out.PutString(insertions);
+  out.bytes() += body.bytes();
+  std::string contents{parseTreeFileVersion +
+      common::Fingerprint{}.Add(out.bytes()).ToString() + out.bytes()};
+
+  // The file is written under a temporary name and then renamed, so that
+  // a concurrent compilation never loads an incomplete file.
+  auto slash{file.rfind('/')};
+  if (slash != std::string::npos) {
+    mkdir(file.substr(0, slash).c_str(), 0777);  // if it does not yet exist
+  }
+  std::string temp{file + ".tmp-XXXXXX"};
+  int fd{mkstemp(&temp[0])};
+  if (fd < 0) {
+    return false;
+  }
+  fchmod(fd, 0644);
+  const char *p{contents.data()};
+  std::size_t bytes{contents.size()};
+  while (bytes > 0) {
+    auto wrote{write(fd, p, bytes)};
+    if (wrote <= 0) {
+      break;
+    }
+    p += wrote;
+    bytes -= wrote;
+  }
+  if (close(fd) != 0 || bytes > 0 ||
+      std::rename(temp.c_str(), file.c_str()) != 0) {
+    unlink(temp.c_str());
+    return false;
+  }
+  return true;
+}
+
+const SourceFile *Parsing::LoadParseTree(
+    const std::string &file, const std::string &path, Options options) {
+  common::TimeReport::Phase phase{options.timeReport, "Load parse tree"};
+  int fd{open(file.c_str(), O_RDONLY)};
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat statbuf;
+  void *vp{MAP_FAILED};
+  if (fstat(fd, &statbuf) == 0 && statbuf.st_size > 0) {
+    vp = mmap(0, statbuf.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if (vp == MAP_FAILED) {
+    return nullptr;
+  }
+  std::size_t bytes{static_cast<std::size_t>(statbuf.st_size)};
+  const SourceFile *sourceFile{LoadParseTree(
+      std::string_view{static_cast<const char *>(vp), bytes}, path, options)};
+  munmap(vp, bytes);
+  if (sourceFile) {
+    options_ = options;
+  }
   return sourceFile;
 }
 
+const SourceFile *Parsing::LoadParseTree(std::string_view contents,
+    const std::string &path, const Options &options) {
+  if (contents.substr(0, parseTreeFileVersion.size()) !=
+      parseTreeFileVersion) {
+    return nullptr;
+  }
+  contents.remove_prefix(parseTreeFileVersion.size());
+  std::string_view fingerprint{contents.substr(0, fingerprintChars)};
+  contents.remove_prefix(fingerprint.size());
+  if (common::Fingerprint{}.Add(contents).ToString() != fingerprint) {
+    return nullptr;
+  }
+  BinaryDecoder in{contents.data(), contents.data() + contents.size()};
+  AllSources &allSources{cooked_.allSources()};
+  if (in.GetString() != ParseTreeSettings(options) ||
+      in.GetUnsigned() != static_cast<std::uint64_t>(allSources.encoding())) {
+    return nullptr;
+  }
+
+  // Open the source files and verify that they have not changed.  The
+  // primary source file is opened as Prescan() would open it; the others
+  // are opened by the paths at which they were found.
+  if (options.isModuleFile) {
+    for (const auto &path : options.searchDirectories) {
+      allSources.PushSearchPathDirectory(path);
+    }
+  }
+  std::vector<const SourceFile *> sources(in.GetUnsigned());
+  for (std::size_t j{0}; j < sources.size(); ++j) {
+    std::string_view sourcePath{in.GetString()};
+    std::size_t bytes{in.GetUnsigned()};
+    std::string_view sourceFingerprint{in.GetString()};
+    std::stringstream fileError;
+    const SourceFile *source{j == 0
+            ? allSources.Open(path, &fileError)
+            : allSources.OpenLocated(std::string{sourcePath}, &fileError)};
+    if (!fileError.str().empty() || source->path() != sourcePath ||
+        source->bytes() != bytes ||
+        SourceFingerprint(*source) != sourceFingerprint) {
+      if (options.isModuleFile) {
+        for (std::size_t k{0}; k < options.searchDirectories.size(); ++k) {
+          allSources.PopSearchPathDirectory();
+        }
+      }
+      return nullptr;
+    }
+    sources[j] = source;
+  }
+  if (!options.isModuleFile) {
+    for (const auto &path : options.searchDirectories) {
+      allSources.PushSearchPathDirectory(path);
+    }
+  }
+
+  // Recreate the origins that Prescan() added.
+  std::map<char, Provenance> insertions;
+  for (char ch : in.GetString()) {
+    insertions.emplace(ch, allSources.CompilerInsertionProvenance(ch));
+  }
+  Provenance start{allSources.range().NextAfter()};
+  auto getRange{[&]() -> ProvenanceRange {
+    switch (in.GetUnsigned()) {
+    case 0: return {};
+    case 1: {
+      Provenance at{start + in.GetUnsigned()};
+      return {at, in.GetUnsigned()};
+    }
+    case 2: return insertions.at(static_cast<char>(in.GetUnsigned()));
+    default: CRASH_NO_CASE;
+    }
+  }};
+  std::size_t size{in.GetUnsigned()};
+  for (auto origins{in.GetUnsigned()}; origins-- > 0;) {
+    switch (in.GetUnsigned()) {
+    case 0: {
+      const SourceFile &source{*sources.at(in.GetUnsigned())};
+      bool isModule{in.GetUnsigned() != 0};
+      allSources.AddIncludedFile(source, getRange(), isModule);
+    } break;
+    case 1: {
+      ProvenanceRange definition{getRange()};
+      ProvenanceRange use{getRange()};
+      allSources.AddMacroCall(definition, use, std::string{in.GetString()});
+    } break;
+    case 2: allSources.AddCompilerInsertion(std::string{in.GetString()}); break;
+    default: CRASH_NO_CASE;
+    }
+  }
+  prescanned_ = {start, allSources.range().NextAfter() - start};
+  CHECK(prescanned_.size() == size);
+
+  for (auto pieces{in.GetUnsigned()}; pieces-- > 0;) {
+    cooked_.PutProvenance(getRange());
+  }
+  cooked_.Marshal(std::string{in.GetString()});
+  if (options.needProvenanceRangeToCharBlockMappings) {
+    cooked_.CompileProvenanceRangeToOffsetMappings();
+  }
+  {
+    common::Arena::Scope scope{&arena_};
+    parseTree_ = DecodeParseTree(in, cooked_);
+  }
+  CHECK(in.IsAtEnd());
+  consumedWholeFile_ = true;
+  finalRestingPlace_ = cooked_.data().data() + cooked_.data().size();
+  return sources[0];
+}
+
 void Parsing::DumpCookedChars(std::ostream &out) const {
   UserState userState{cooked_, common::LanguageFeatureControl{}};
   ParseState parseState{cooked_};
@@ -107,19 +445,132 @@ void Parsing::DumpParsingLog(std::ostream &out) const {
   log_.Dump(out, cooked_);
 }
 
-void Parsing::Parse(std::ostream *out) {
+void Parsing::DumpParseMemoStatistics(std::ostream &out) const {
+  memoTable_.Dump(out);
+}
+
+void Parsing::DumpParserProfile(std::ostream &out, std::size_t top) const {
+  parserProfile_.Dump(out, top);
+}
+
+std::optional<Program> Parsing::ParseRange(ParseState &parseState,
+    std::ostream *out, ParsingLog &log, ParseMemoTable &memoTable,
+    ParserProfile &profile) const {
   UserState userState{cooked_, options_.features};
   userState.set_debugOutput(out)
       .set_instrumentedParse(options_.instrumentedParse)
-      .set_log(&log_);
-  ParseState parseState{cooked_};
+      .set_log(&log);
+  if (options_.memoizeParse) {
+    userState.set_memoTable(&memoTable);
+  }
+  if (options_.profileParse) {
+    userState.set_parserProfile(&profile);
+  }
   parseState.set_inFixedForm(options_.isFixedForm).set_userState(&userState);
-  parseTree_ = program.Parse(parseState);
+  std::optional<Program> result{program.Parse(parseState)};
+  parseState.set_userState(nullptr);
   CHECK(
       !parseState.anyErrorRecovery() || parseState.messages().AnyFatalError());
-  consumedWholeFile_ = parseState.IsAtEnd();
-  messages_.Annex(std::move(parseState.messages()));
-  finalRestingPlace_ = parseState.GetLocation();
+  return result;
+}
+
+// Splits the cooked characters into ranges of whole program units and
+// parses them on parseThreads threads.  The results are spliced together
+// in source order, so they're the same as those of a serial parse.  When
+// a range can't be parsed cleanly by itself, perhaps because a boundary
+// was misplaced, this returns false so that the parse can be repeated
+// serially and produce the usual messages.
+bool Parsing::ParseInParallel(std::ostream *out) {
+  const std::string &data{cooked_.data()};
+  std::vector<const char *> boundaries{
+      FindProgramUnitBoundaries(data.data(), data.size())};
+  if (boundaries.empty()) {
+    return false;
+  }
+  struct Range {
+    common::Arena arena;  // outlives the other members
+    const char *start{nullptr}, *limit{nullptr};
+    std::optional<ParseState> state;
+    std::optional<Program> program;
+    ParsingLog log;
+    ParseMemoTable memoTable;
+    ParserProfile profile;
+  };
+  // Make a few ranges per thread to balance the load.
+  std::size_t ranges{4 * static_cast<std::size_t>(options_.parseThreads)};
+  std::size_t rangeBytes{data.size() / ranges + 1};
+  std::list<Range> work;  // stable addresses for the worker threads
+  const char *start{data.data()}, *limit{start + data.size()};
+  for (const char *boundary : boundaries) {
+    if (static_cast<std::size_t>(boundary - start) >= rangeBytes) {
+      Range &range{work.emplace_back()};
+      range.start = start;
+      range.limit = start = boundary;
+    }
+  }
+  Range &last{work.emplace_back()};
+  last.start = start;
+  last.limit = limit;
+  if (work.size() < 2) {
+    return false;
+  }
+  std::vector<Range *> queue;
+  for (Range &range : work) {
+    queue.push_back(&range);
+  }
+  std::atomic<std::size_t> next{0};
+  auto worker{[&]() {
+    for (std::size_t j; (j = next++) < queue.size();) {
+      Range &range{*queue[j]};
+      common::Arena::Scope scope{&range.arena};
+      range.state.emplace(range.start, range.limit);
+      range.program = ParseRange(
+          *range.state, out, range.log, range.memoTable, range.profile);
+    }
+  }};
+  std::vector<std::thread> threads;
+  std::size_t threadCount{std::min(
+      queue.size(), static_cast<std::size_t>(options_.parseThreads))};
+  for (std::size_t j{1}; j < threadCount; ++j) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  for (const Range &range : work) {
+    if (!range.program || !range.state->IsAtEnd() ||
+        range.state->anyErrorRecovery() ||
+        range.state->messages().AnyFatalError()) {
+      return false;
+    }
+  }
+  parseTree_ = Program{List<ProgramUnit>{}};
+  for (Range &range : work) {
+    parseTree_->v.splice(parseTree_->v.end(), range.program->v);
+    messages_.Annex(std::move(range.state->messages()));
+    memoTable_.AddStatistics(range.memoTable);
+    parserProfile_.Merge(range.profile);
+    arena_.Adopt(std::move(range.arena));
+  }
+  consumedWholeFile_ = true;
+  finalRestingPlace_ = work.back().state->GetLocation();
+  return true;
+}
+
+void Parsing::Parse(std::ostream *out) {
+  common::TimeReport::Measure(options_.timeReport, "Parse", [&]() {
+    if (options_.parseThreads > 1 && !options_.instrumentedParse &&
+        ParseInParallel(out)) {
+      return;
+    }
+    common::Arena::Scope scope{&arena_};
+    ParseState parseState{cooked_};
+    parseTree_ = ParseRange(parseState, out, log_, memoTable_, parserProfile_);
+    consumedWholeFile_ = parseState.IsAtEnd();
+    messages_.Annex(std::move(parseState.messages()));
+    finalRestingPlace_ = parseState.GetLocation();
+  });
 }
 
 void Parsing::ClearLog() { log_.clear(); }
@@ -17,16 +17,23 @@
 
 #include "characters.h"
 #include "instrumented-parser.h"
+#include "memoized-parser.h"
 #include "message.h"
 #include "parse-tree.h"
 #include "provenance.h"
 #include "../common/Fortran-features.h"
+#include "../common/arena.h"
 #include <optional>
 #include <ostream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+namespace Fortran::common {
+class TimeReport;
+}
+
 namespace Fortran::parser {
 
 struct Options {
@@ -40,8 +47,12 @@ struct Options {
   std::vector<std::string> searchDirectories;
   std::vector<Predefinition> predefinitions;
   bool instrumentedParse{false};
+  bool memoizeParse{false};  // -fparse-memo
+  int parseThreads{1};  // -fparse-threads=N
+  bool profileParse{false};  // -fdebug-parser-profile
   bool isModuleFile{false};
   bool needProvenanceRangeToCharBlockMappings{false};
+  common::TimeReport *timeReport{nullptr};  // -ftime-report
 };
 
 class Parsing {
@@ -56,9 +67,20 @@ public:
   std::optional<Program> &parseTree() { return parseTree_; }
 
   const SourceFile *Prescan(const std::string &path, Options);
+  // Instead of Prescan() and Parse(), loads the cooked characters and
+  // parse tree that SaveParseTree() wrote after an earlier compilation
+  // of the same source with the same options.  Returns null when the
+  // file does not exist or any of the sources has since changed.
+  const SourceFile *LoadParseTree(
+      const std::string &file, const std::string &path, Options);
+  // Returns false when there is nothing worth saving, e.g. when the
+  // parse produced messages, or when the file cannot be written.
+  bool SaveParseTree(const std::string &file) const;
   void DumpCookedChars(std::ostream &) const;
   void DumpProvenance(std::ostream &) const;
   void DumpParsingLog(std::ostream &) const;
+  void DumpParseMemoStatistics(std::ostream &) const;
+  void DumpParserProfile(std::ostream &, std::size_t top) const;
   void Parse(std::ostream *debugOutput = nullptr);
   void ClearLog();
 
@@ -71,13 +93,28 @@ public:
   bool ForTesting(std::string path, std::ostream &);
 
 private:
+  const SourceFile *LoadParseTree(
+      std::string_view contents, const std::string &path, const Options &);
+  std::optional<Program> ParseRange(ParseState &, std::ostream *debugOutput,
+      ParsingLog &, ParseMemoTable &, ParserProfile &) const;
+  bool ParseInParallel(std::ostream *debugOutput);
+
   Options options_;
   CookedSource cooked_;
+  ProvenanceRange prescanned_;  // the origins added by Prescan()
   Messages messages_;
   bool consumedWholeFile_{false};
   const char *finalRestingPlace_{nullptr};
+  common::Arena arena_;  // for the parse tree; must outlive it
   std::optional<Program> parseTree_;
   ParsingLog log_;
+  ParseMemoTable memoTable_;
+  ParserProfile parserProfile_;
 };
+
+// The name of the file in a directory that holds the saved parse tree of
+// a source file, should it have been compiled with these options.
+std::string ParseTreeFileName(
+    const std::string &directory, const std::string &path, const Options &);
 }
 #endif  // FORTRAN_PARSER_PARSING_H_
@@ -178,6 +178,13 @@ const SourceFile *AllSources::Open(std::string path, std::stringstream *error) {
   return ownedSourceFiles_.emplace_back(std::move(source)).get();
 }
 
+const SourceFile *AllSources::OpenLocated(
+    std::string path, std::stringstream *error) {
+  std::unique_ptr<SourceFile> source{std::make_unique<SourceFile>(encoding_)};
+  source->Open(path, error);
+  return ownedSourceFiles_.emplace_back(std::move(source)).get();
+}
+
 const SourceFile *AllSources::ReadStandardInput(std::stringstream *error) {
   std::unique_ptr<SourceFile> source{std::make_unique<SourceFile>(encoding_)};
   if (source->ReadStandardInput(error)) {
@@ -324,6 +331,20 @@ std::optional<ProvenanceRange> AllSources::GetFirstFileProvenance() const {
   return std::nullopt;
 }
 
+std::vector<std::string> AllSources::GetSourceFilePaths() const {
+  std::vector<std::string> result;
+  for (const auto &origin : origin_) {
+    if (const auto *inclusion{std::get_if<Inclusion>(&origin.u)}) {
+      if (!inclusion->isModule &&
+          std::find(result.begin(), result.end(), inclusion->source.path()) ==
+              result.end()) {
+        result.push_back(inclusion->source.path());
+      }
+    }
+  }
+  return result;
+}
+
 std::string AllSources::GetPath(Provenance at) const {
   const SourceFile *source{GetSourceFile(at)};
   return source ? source->path() : ""s;
@@ -362,6 +383,28 @@ ProvenanceRange AllSources::IntersectionWithSourceFiles(
   }
 }
 
+AllSources::OriginDescription AllSources::DescribeOrigin(
+    Provenance at) const {
+  const Origin &origin{MapToOrigin(at)};
+  OriginDescription result;
+  result.covers = origin.covers;
+  result.replaces = origin.replaces;
+  std::visit(
+      common::visitors{
+          [&](const Inclusion &inc) {
+            result.source = &inc.source;
+            result.isModule = inc.isModule;
+          },
+          [&](const Macro &mac) {
+            result.definition = mac.definition;
+            result.text = mac.expansion;
+          },
+          [&](const CompilerInsertion &ins) { result.text = ins.text; },
+      },
+      origin.u);
+  return result;
+}
+
 AllSources::Origin::Origin(ProvenanceRange r, const SourceFile &source)
   : u{Inclusion{source}}, covers{r} {}
 AllSources::Origin::Origin(ProvenanceRange r, const SourceFile &included,
@@ -465,6 +508,12 @@ void CookedSource::Marshal() {
   buffer_.clear();
 }
 
+void CookedSource::Marshal(std::string &&data) {
+  CHECK(buffer_.bytes() == 0);
+  CHECK(provenanceMap_.SizeInBytes() > data.size());
+  data_ = std::move(data);
+}
+
 void CookedSource::CompileProvenanceRangeToOffsetMappings() {
   if (invertedMap_.empty()) {
     invertedMap_ = provenanceMap_.Invert(allSources_);
@@ -147,6 +147,7 @@ public:
   ~AllSources();
 
   std::size_t size() const { return range_.size(); }
+  ProvenanceRange range() const { return range_; }
   const char &operator[](Provenance) const;
   Encoding encoding() const { return encoding_; }
   AllSources &set_encoding(Encoding e) {
@@ -157,6 +158,9 @@ public:
   void PushSearchPathDirectory(std::string);
   std::string PopSearchPathDirectory();
   const SourceFile *Open(std::string path, std::stringstream *error);
+  // Opens a file by the path() of a SourceFile that an earlier Open()
+  // located, without searching for it again
+  const SourceFile *OpenLocated(std::string path, std::stringstream *error);
   const SourceFile *ReadStandardInput(std::stringstream *error);
 
   ProvenanceRange AddIncludedFile(
@@ -175,6 +179,8 @@ public:
       Provenance, std::size_t *offset = nullptr) const;
   std::optional<SourcePosition> GetSourcePosition(Provenance) const;
   std::optional<ProvenanceRange> GetFirstFileProvenance() const;
+  // Paths of the source files that were read, excluding module files
+  std::vector<std::string> GetSourceFilePaths() const;
   std::string GetPath(Provenance) const;  // __FILE__
   int GetLineNumber(Provenance) const;  // __LINE__
   Provenance CompilerInsertionProvenance(char ch);
@@ -182,6 +188,19 @@ public:
   ProvenanceRange IntersectionWithSourceFiles(ProvenanceRange) const;
   std::ostream &Dump(std::ostream &) const;
 
+  // Describes the origin that covers a provenance well enough for it to
+  // be recreated by AddIncludedFile(), AddMacroCall(), or
+  // AddCompilerInsertion() elsewhere; e.g., when a saved parse tree is
+  // loaded (see Parsing::LoadParseTree()).
+  struct OriginDescription {
+    ProvenanceRange covers, replaces;
+    const SourceFile *source{nullptr};  // included file, if any
+    bool isModule{false};
+    ProvenanceRange definition;  // macro definition, if a macro call
+    std::string text;  // macro expansion or compiler insertion
+  };
+  OriginDescription DescribeOrigin(Provenance) const;
+
 private:
   struct Inclusion {
     const SourceFile &source;
@@ -263,8 +282,14 @@ public:
   }
 
   void Marshal();  // marshals text into one contiguous block
+  // Instead of Marshal(), installs the characters of an earlier prescan
+  // whose provenances have been restored with PutProvenance()
+  void Marshal(std::string &&);
   void CompileProvenanceRangeToOffsetMappings();
   std::string AcquireData() { return std::move(data_); }
+  const OffsetToProvenanceMappings &provenanceMap() const {
+    return provenanceMap_;
+  }
   std::ostream &Dump(std::ostream &) const;
 
 private:
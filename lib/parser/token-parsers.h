@@ -22,6 +22,7 @@
 #include "char-set.h"
 #include "characters.h"
 #include "instrumented-parser.h"
+#include "memoized-parser.h"
 #include "provenance.h"
 #include "type-parsers.h"
 #include "../common/idioms.h"
@@ -634,6 +635,11 @@ constexpr struct SkipStuffBeforeStatement {
         break;
       }
     }
+    if (UserState * ustate{state.userState()}) {
+      if (ParseMemoTable * memoTable{ustate->memoTable()}) {
+        memoTable->StartStatement(state.GetLocation());
+      }
+    }
     return {Success{}};
   }
 } skipStuffBeforeStatement;
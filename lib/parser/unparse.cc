@@ -207,9 +207,9 @@ public:
     Walk("_", std::get<std::optional<KindParam>>(x.t));
   }
   void Unparse(const DerivedTypeStmt &x) {  // R727
-    Word("TYPE"), Walk(", ", std::get<std::list<TypeAttrSpec>>(x.t), ", ");
+    Word("TYPE"), Walk(", ", std::get<List<TypeAttrSpec>>(x.t), ", ");
     Put(" :: "), Walk(std::get<Name>(x.t));
-    Walk("(", std::get<std::list<Name>>(x.t), ", ", ")");
+    Walk("(", std::get<List<Name>>(x.t), ", ", ")");
     Indent();
   }
   void Unparse(const Abstract &) {  // R728, &c.
@@ -228,7 +228,7 @@ public:
   void Unparse(const TypeParamDefStmt &x) {  // R732
     Walk(std::get<IntegerTypeSpec>(x.t));
     Put(", "), Walk(std::get<common::TypeParamAttr>(x.t));
-    Put(" :: "), Walk(std::get<std::list<TypeParamDecl>>(x.t), ", ");
+    Put(" :: "), Walk(std::get<List<TypeParamDecl>>(x.t), ", ");
   }
   void Unparse(const TypeParamDecl &x) {  // R733
     Walk(std::get<Name>(x.t));
@@ -236,8 +236,8 @@ public:
   }
   void Unparse(const DataComponentDefStmt &x) {  // R737
     const auto &dts{std::get<DeclarationTypeSpec>(x.t)};
-    const auto &attrs{std::get<std::list<ComponentAttrSpec>>(x.t)};
-    const auto &decls{std::get<std::list<ComponentDecl>>(x.t)};
+    const auto &attrs{std::get<List<ComponentAttrSpec>>(x.t)};
+    const auto &decls{std::get<List<ComponentDecl>>(x.t)};
     Walk(dts), Walk(", ", attrs, ", ");
     if (!attrs.empty() ||
         (!std::holds_alternative<DeclarationTypeSpec::Record>(dts.u) &&
@@ -247,7 +247,7 @@ public:
                       std::get<std::optional<Initialization>>(d.t)};
                   return init &&
                       std::holds_alternative<
-                          std::list<common::Indirection<DataStmtValue>>>(
+                          List<common::Indirection<DataStmtValue>>>(
                           init->u);
                 }))) {
       Put(" ::");
@@ -287,7 +287,7 @@ public:
   void Unparse(const ComponentArraySpec &x) {  // R740
     std::visit(
         common::visitors{
-            [&](const std::list<ExplicitShapeSpec> &y) { Walk(y, ","); },
+            [&](const List<ExplicitShapeSpec> &y) { Walk(y, ","); },
             [&](const DeferredShapeSpecList &y) { Walk(y); },
         },
         x.u);
@@ -295,8 +295,8 @@ public:
   void Unparse(const ProcComponentDefStmt &x) {  // R741
     Word("PROCEDURE(");
     Walk(std::get<std::optional<ProcInterface>>(x.t)), Put(')');
-    Walk(", ", std::get<std::list<ProcComponentAttrSpec>>(x.t), ", ");
-    Put(" :: "), Walk(std::get<std::list<ProcDecl>>(x.t), ", ");
+    Walk(", ", std::get<List<ProcComponentAttrSpec>>(x.t), ", ");
+    Put(" :: "), Walk(std::get<List<ProcDecl>>(x.t), ", ");
   }
   void Unparse(const NoPass &) {  // R742
     Word("NOPASS");
@@ -308,7 +308,7 @@ public:
             [&](const ConstantExpr &y) { Put(" = "), Walk(y); },
             [&](const NullInit &y) { Put(" => "), Walk(y); },
             [&](const InitialDataTarget &y) { Put(" => "), Walk(y); },
-            [&](const std::list<common::Indirection<DataStmtValue>> &y) {
+            [&](const List<common::Indirection<DataStmtValue>> &y) {
               Walk("/", y, ", ", "/");
             },
         },
@@ -333,7 +333,7 @@ public:
   void Unparse(const TypeBoundGenericStmt &x) {  // R751
     Word("GENERIC"), Walk(", ", std::get<std::optional<AccessSpec>>(x.t));
     Put(" :: "), Walk(std::get<common::Indirection<GenericSpec>>(x.t));
-    Put(" => "), Walk(std::get<std::list<Name>>(x.t), ", ");
+    Put(" => "), Walk(std::get<List<Name>>(x.t), ", ");
   }
   void Post(const BindAttr::Deferred &) { Word("DEFERRED"); }  // R752
   void Post(const BindAttr::Non_Overridable &) { Word("NON_OVERRIDABLE"); }
@@ -342,7 +342,7 @@ public:
   }
   void Unparse(const DerivedTypeSpec &x) {  // R754
     Walk(std::get<Name>(x.t));
-    Walk("(", std::get<std::list<TypeParamSpec>>(x.t), ",", ")");
+    Walk("(", std::get<List<TypeParamSpec>>(x.t), ",", ")");
   }
   void Unparse(const TypeParamSpec &x) {  // R755
     Walk(std::get<std::optional<Keyword>>(x.t), "=");
@@ -350,7 +350,7 @@ public:
   }
   void Unparse(const StructureConstructor &x) {  // R756
     Walk(std::get<DerivedTypeSpec>(x.t));
-    Put('('), Walk(std::get<std::list<ComponentSpec>>(x.t), ", "), Put(')');
+    Put('('), Walk(std::get<List<ComponentSpec>>(x.t), ", "), Put(')');
   }
   void Unparse(const ComponentSpec &x) {  // R757
     Walk(std::get<std::optional<Keyword>>(x.t), "=");
@@ -387,7 +387,7 @@ public:
     Walk(",", x.step);
   }
   void Unparse(const AcImpliedDo &x) {  // R774
-    Put('('), Walk(std::get<std::list<AcValue>>(x.t), ", ");
+    Put('('), Walk(std::get<List<AcValue>>(x.t), ", ");
     Put(", "), Walk(std::get<AcImpliedDoControl>(x.t)), Put(')');
   }
   void Unparse(const AcImpliedDoControl &x) {  // R775
@@ -397,13 +397,13 @@ public:
 
   void Unparse(const TypeDeclarationStmt &x) {  // R801
     const auto &dts{std::get<DeclarationTypeSpec>(x.t)};
-    const auto &attrs{std::get<std::list<AttrSpec>>(x.t)};
-    const auto &decls{std::get<std::list<EntityDecl>>(x.t)};
+    const auto &attrs{std::get<List<AttrSpec>>(x.t)};
+    const auto &decls{std::get<List<EntityDecl>>(x.t)};
     Walk(dts), Walk(", ", attrs, ", ");
 
     static const auto isInitializerOldStyle{[](const Initialization &i) {
       return std::holds_alternative<
-          std::list<common::Indirection<DataStmtValue>>>(i.u);
+          List<common::Indirection<DataStmtValue>>>(i.u);
     }};
     static const auto hasAssignmentInitializer{[](const EntityDecl &d) {
       // Does a declaration have a new-style =x initializer?
@@ -448,7 +448,7 @@ public:
     if (useDoubledColons()) {
       Put(" ::");
     }
-    Put(' '), Walk(std::get<std::list<EntityDecl>>(x.t), ", ");
+    Put(' '), Walk(std::get<List<EntityDecl>>(x.t), ", ");
   }
   void Before(const AttrSpec &x) {  // R802
     std::visit(
@@ -498,7 +498,7 @@ public:
     }
   }
   void Unparse(const ExplicitCoshapeSpec &x) {  // R811
-    Walk(std::get<std::list<ExplicitShapeSpec>>(x.t), ",", ",");
+    Walk(std::get<List<ExplicitShapeSpec>>(x.t), ",", ",");
     Walk(std::get<std::optional<SpecificationExpr>>(x.t), ":"), Put('*');
   }
   void Unparse(const ExplicitShapeSpec &x) {  // R812 - R813 & R816 - R818
@@ -508,8 +508,8 @@ public:
   void Unparse(const ArraySpec &x) {  // R815
     std::visit(
         common::visitors{
-            [&](const std::list<ExplicitShapeSpec> &y) { Walk(y, ","); },
-            [&](const std::list<AssumedShapeSpec> &y) { Walk(y, ","); },
+            [&](const List<ExplicitShapeSpec> &y) { Walk(y, ","); },
+            [&](const List<AssumedShapeSpec> &y) { Walk(y, ","); },
             [&](const DeferredShapeSpecList &y) { Walk(y); },
             [&](const AssumedSizeSpec &y) { Walk(y); },
             [&](const ImpliedShapeSpec &y) { Walk(y); },
@@ -531,7 +531,7 @@ public:
     Put('*');
   }
   void Unparse(const AssumedSizeSpec &x) {  // R822
-    Walk(std::get<std::list<ExplicitShapeSpec>>(x.t), ",", ",");
+    Walk(std::get<List<ExplicitShapeSpec>>(x.t), ",", ",");
     Walk(std::get<AssumedImpliedSpec>(x.t));
   }
   void Unparse(const ImpliedShapeSpec &x) {  // R823
@@ -553,7 +553,7 @@ public:
   }
   void Unparse(const AccessStmt &x) {  // R827
     Walk(std::get<AccessSpec>(x.t));
-    Walk(" :: ", std::get<std::list<AccessId>>(x.t), ", ");
+    Walk(" :: ", std::get<List<AccessId>>(x.t), ", ");
   }
   void Unparse(const AllocatableStmt &x) {  // R829
     Word("ALLOCATABLE :: "), Walk(x.v, ", ");
@@ -588,11 +588,11 @@ public:
     Word("DATA "), Walk(x.v, ", ");
   }
   void Unparse(const DataStmtSet &x) {  // R838
-    Walk(std::get<std::list<DataStmtObject>>(x.t), ", ");
-    Put('/'), Walk(std::get<std::list<DataStmtValue>>(x.t), ", "), Put('/');
+    Walk(std::get<List<DataStmtObject>>(x.t), ", ");
+    Put('/'), Walk(std::get<List<DataStmtValue>>(x.t), ", "), Put('/');
   }
   void Unparse(const DataImpliedDo &x) {  // R840, R842
-    Put('('), Walk(std::get<std::list<DataIDoObject>>(x.t), ", "), Put(',');
+    Put('('), Walk(std::get<List<DataIDoObject>>(x.t), ", "), Put(',');
     Walk(std::get<std::optional<IntegerTypeSpec>>(x.t), "::");
     Walk(std::get<DataImpliedDo::Bounds>(x.t)), Put(')');
   }
@@ -651,8 +651,8 @@ public:
     Word("IMPLICIT ");
     std::visit(
         common::visitors{
-            [&](const std::list<ImplicitSpec> &y) { Walk(y, ", "); },
-            [&](const std::list<ImplicitStmt::ImplicitNoneNameSpec> &y) {
+            [&](const List<ImplicitSpec> &y) { Walk(y, ", "); },
+            [&](const List<ImplicitStmt::ImplicitNoneNameSpec> &y) {
               Word("NONE"), Walk(" (", y, ", ", ")");
             },
         },
@@ -660,7 +660,7 @@ public:
   }
   void Unparse(const ImplicitSpec &x) {  // R864
     Walk(std::get<DeclarationTypeSpec>(x.t));
-    Put('('), Walk(std::get<std::list<LetterSpec>>(x.t), ", "), Put(')');
+    Put('('), Walk(std::get<List<LetterSpec>>(x.t), ", "), Put(')');
   }
   void Unparse(const LetterSpec &x) {  // R865
     Put(*std::get<const char *>(x.t));
@@ -686,12 +686,12 @@ public:
   }
   void Unparse(const NamelistStmt::Group &x) {
     Put('/'), Walk(std::get<Name>(x.t)), Put('/');
-    Walk(std::get<std::list<Name>>(x.t), ", ");
+    Walk(std::get<List<Name>>(x.t), ", ");
   }
   void Unparse(const EquivalenceStmt &x) {  // R870, R871
     Word("EQUIVALENCE");
     const char *separator{" "};
-    for (const std::list<EquivalenceObject> &y : x.v) {
+    for (const List<EquivalenceObject> &y : x.v) {
       Put(separator), Put('('), Walk(y), Put(')');
       separator = ", ";
     }
@@ -706,7 +706,7 @@ public:
   }
   void Unparse(const CommonStmt::Block &x) {
     Word("/"), Walk(std::get<std::optional<Name>>(x.t)), Word("/");
-    Walk(std::get<std::list<CommonBlockObject>>(x.t));
+    Walk(std::get<List<CommonBlockObject>>(x.t));
   }
 
   void Unparse(const Substring &x) {  // R908, R909
@@ -744,8 +744,8 @@ public:
     Walk(":", std::get<2>(x.t));
   }
   void Unparse(const ImageSelector &x) {  // R924
-    Put('['), Walk(std::get<std::list<Cosubscript>>(x.t), ",");
-    Walk(",", std::get<std::list<ImageSelectorSpec>>(x.t), ","), Put(']');
+    Put('['), Walk(std::get<List<Cosubscript>>(x.t), ",");
+    Walk(",", std::get<List<ImageSelectorSpec>>(x.t), ","), Put(']');
   }
   void Before(const ImageSelectorSpec::Stat &) {  // R926
     Word("STAT=");
@@ -759,8 +759,8 @@ public:
   void Unparse(const AllocateStmt &x) {  // R927
     Word("ALLOCATE(");
     Walk(std::get<std::optional<TypeSpec>>(x.t), "::");
-    Walk(std::get<std::list<Allocation>>(x.t), ", ");
-    Walk(", ", std::get<std::list<AllocOpt>>(x.t), ", "), Put(')');
+    Walk(std::get<List<Allocation>>(x.t), ", ");
+    Walk(", ", std::get<List<AllocOpt>>(x.t), ", "), Put(')');
   }
   void Before(const AllocOpt &x) {  // R928, R931
     std::visit(
@@ -773,7 +773,7 @@ public:
   }
   void Unparse(const Allocation &x) {  // R932
     Walk(std::get<AllocateObject>(x.t));
-    Walk("(", std::get<std::list<AllocateShapeSpec>>(x.t), ",", ")");
+    Walk("(", std::get<List<AllocateShapeSpec>>(x.t), ",", ")");
     Walk("[", std::get<std::optional<AllocateCoarraySpec>>(x.t), "]");
   }
   void Unparse(const AllocateShapeSpec &x) {  // R934 & R938
@@ -781,7 +781,7 @@ public:
     Walk(std::get<BoundExpr>(x.t));
   }
   void Unparse(const AllocateCoarraySpec &x) {  // R937
-    Walk(std::get<std::list<AllocateCoshapeSpec>>(x.t), ",", ",");
+    Walk(std::get<List<AllocateCoshapeSpec>>(x.t), ",", ",");
     Walk(std::get<std::optional<BoundExpr>>(x.t), ":"), Put('*');
   }
   void Unparse(const NullifyStmt &x) {  // R939
@@ -789,8 +789,8 @@ public:
   }
   void Unparse(const DeallocateStmt &x) {  // R941
     Word("DEALLOCATE(");
-    Walk(std::get<std::list<AllocateObject>>(x.t), ", ");
-    Walk(", ", std::get<std::list<StatOrErrmsg>>(x.t), ", "), Put(')');
+    Walk(std::get<List<AllocateObject>>(x.t), ", ");
+    Walk(", ", std::get<List<StatOrErrmsg>>(x.t), ", "), Put(')');
   }
   void Before(const StatOrErrmsg &x) {  // R942 & R1165
     std::visit(
@@ -852,10 +852,10 @@ public:
     Walk(std::get<DataRef>(x.t));
     std::visit(
         common::visitors{
-            [&](const std::list<BoundsRemapping> &y) {
+            [&](const List<BoundsRemapping> &y) {
               Put('('), Walk(y), Put(')');
             },
-            [&](const std::list<BoundsSpec> &y) { Walk("(", y, ", ", ")"); },
+            [&](const List<BoundsSpec> &y) { Walk("(", y, ", ", ")"); },
         },
         std::get<PointerAssignmentStmt::Bounds>(x.t).u);
     Put(" => "), Walk(std::get<Expr>(x.t));
@@ -901,7 +901,7 @@ public:
   void Unparse(const AssociateStmt &x) {  // R1103
     Walk(std::get<std::optional<Name>>(x.t), ": ");
     Word("ASSOCIATE (");
-    Walk(std::get<std::list<Association>>(x.t), ", "), Put(')'), Indent();
+    Walk(std::get<List<Association>>(x.t), ", "), Put(')'), Indent();
   }
   void Unparse(const Association &x) {  // R1104
     Walk(x.t, " => ");
@@ -918,8 +918,8 @@ public:
   void Unparse(const ChangeTeamStmt &x) {  // R1112
     Walk(std::get<std::optional<Name>>(x.t), ": ");
     Word("CHANGE TEAM ("), Walk(std::get<TeamValue>(x.t));
-    Walk(", ", std::get<std::list<CoarrayAssociation>>(x.t), ", ");
-    Walk(", ", std::get<std::list<StatOrErrmsg>>(x.t), ", "), Put(')');
+    Walk(", ", std::get<List<CoarrayAssociation>>(x.t), ", ");
+    Walk(", ", std::get<List<StatOrErrmsg>>(x.t), ", "), Put(')');
     Indent();
   }
   void Unparse(const CoarrayAssociation &x) {  // R1113
@@ -927,12 +927,12 @@ public:
   }
   void Unparse(const EndChangeTeamStmt &x) {  // R1114
     Outdent(), Word("END TEAM (");
-    Walk(std::get<std::list<StatOrErrmsg>>(x.t), ", ");
+    Walk(std::get<List<StatOrErrmsg>>(x.t), ", ");
     Put(')'), Walk(" ", std::get<std::optional<Name>>(x.t));
   }
   void Unparse(const CriticalStmt &x) {  // R1117
     Walk(std::get<std::optional<Name>>(x.t), ": ");
-    Word("CRITICAL ("), Walk(std::get<std::list<StatOrErrmsg>>(x.t), ", ");
+    Word("CRITICAL ("), Walk(std::get<List<StatOrErrmsg>>(x.t), ", ");
     Put(')'), Indent();
   }
   void Unparse(const EndCriticalStmt &x) {  // R1118
@@ -964,7 +964,7 @@ public:
   }
   void Unparse(const ConcurrentHeader &x) {  // R1125
     Put('('), Walk(std::get<std::optional<IntegerTypeSpec>>(x.t), "::");
-    Walk(std::get<std::list<ConcurrentControl>>(x.t), ", ");
+    Walk(std::get<List<ConcurrentControl>>(x.t), ", ");
     Walk(", ", std::get<std::optional<ScalarLogicalExpr>>(x.t)), Put(')');
   }
   void Unparse(const ConcurrentControl &x) {  // R1126 - R1128
@@ -1025,7 +1025,7 @@ public:
   void Unparse(const CaseSelector &x) {  // R1145
     std::visit(
         common::visitors{
-            [&](const std::list<CaseValueRange> &y) {
+            [&](const List<CaseValueRange> &y) {
               Put('('), Walk(y), Put(')');
             },
             [&](const Default &) { Word("DEFAULT"); },
@@ -1101,18 +1101,18 @@ public:
   void Unparse(const SyncImagesStmt &x) {  // R1166
     Word("SYNC IMAGES (");
     Walk(std::get<SyncImagesStmt::ImageSet>(x.t));
-    Walk(", ", std::get<std::list<StatOrErrmsg>>(x.t), ", "), Put(')');
+    Walk(", ", std::get<List<StatOrErrmsg>>(x.t), ", "), Put(')');
   }
   void Unparse(const SyncMemoryStmt &x) {  // R1168
     Word("SYNC MEMORY ("), Walk(x.v, ", "), Put(')');
   }
   void Unparse(const SyncTeamStmt &x) {  // R1169
     Word("SYNC TEAM ("), Walk(std::get<TeamValue>(x.t));
-    Walk(", ", std::get<std::list<StatOrErrmsg>>(x.t), ", "), Put(')');
+    Walk(", ", std::get<List<StatOrErrmsg>>(x.t), ", "), Put(')');
   }
   void Unparse(const EventPostStmt &x) {  // R1170
     Word("EVENT POST ("), Walk(std::get<EventVariable>(x.t));
-    Walk(", ", std::get<std::list<StatOrErrmsg>>(x.t), ", "), Put(')');
+    Walk(", ", std::get<List<StatOrErrmsg>>(x.t), ", "), Put(')');
   }
   void Before(const EventWaitStmt::EventWaitSpec &x) {  // R1173, R1174
     std::visit(
@@ -1124,13 +1124,13 @@ public:
   }
   void Unparse(const EventWaitStmt &x) {  // R1170
     Word("EVENT WAIT ("), Walk(std::get<EventVariable>(x.t));
-    Walk(", ", std::get<std::list<EventWaitStmt::EventWaitSpec>>(x.t), ", ");
+    Walk(", ", std::get<List<EventWaitStmt::EventWaitSpec>>(x.t), ", ");
     Put(')');
   }
   void Unparse(const FormTeamStmt &x) {  // R1175, R1177
     Word("FORM TEAM ("), Walk(std::get<ScalarIntExpr>(x.t));
     Put(','), Walk(std::get<TeamVariable>(x.t));
-    Walk(", ", std::get<std::list<FormTeamStmt::FormTeamSpec>>(x.t), ", ");
+    Walk(", ", std::get<List<FormTeamStmt::FormTeamSpec>>(x.t), ", ");
     Put(')');
   }
   void Before(const FormTeamStmt::FormTeamSpec &x) {  // R1176, R1178
@@ -1143,7 +1143,7 @@ public:
   }
   void Unparse(const LockStmt &x) {  // R1179
     Word("LOCK ("), Walk(std::get<LockVariable>(x.t));
-    Walk(", ", std::get<std::list<LockStmt::LockStat>>(x.t), ", ");
+    Walk(", ", std::get<List<LockStmt::LockStat>>(x.t), ", ");
     Put(')');
   }
   void Before(const LockStmt::LockStat &x) {  // R1180
@@ -1156,7 +1156,7 @@ public:
   }
   void Unparse(const UnlockStmt &x) {  // R1181
     Word("UNLOCK ("), Walk(std::get<LockVariable>(x.t));
-    Walk(", ", std::get<std::list<StatOrErrmsg>>(x.t), ", ");
+    Walk(", ", std::get<List<StatOrErrmsg>>(x.t), ", ");
     Put(')');
   }
 
@@ -1253,7 +1253,7 @@ public:
   }
   void Unparse(const PrintStmt &x) {  // R1212
     Word("PRINT "), Walk(std::get<Format>(x.t));
-    Walk(", ", std::get<std::list<OutputItem>>(x.t), ", ");
+    Walk(", ", std::get<List<OutputItem>>(x.t), ", ");
   }
   bool Pre(const IoControlSpec &x) {  // R1213
     return std::visit(
@@ -1318,11 +1318,11 @@ public:
         x.u);
   }
   void Unparse(const InputImpliedDo &x) {  // R1218
-    Put('('), Walk(std::get<std::list<InputItem>>(x.t), ", "), Put(", ");
+    Put('('), Walk(std::get<List<InputItem>>(x.t), ", "), Put(", ");
     Walk(std::get<IoImpliedDoControl>(x.t)), Put(')');
   }
   void Unparse(const OutputImpliedDo &x) {  // R1219
-    Put('('), Walk(std::get<std::list<OutputItem>>(x.t), ", "), Put(", ");
+    Put('('), Walk(std::get<List<OutputItem>>(x.t), ", "), Put(", ");
     Walk(std::get<IoImpliedDoControl>(x.t)), Put(')');
   }
   void Unparse(const WaitStmt &x) {  // R1222
@@ -1370,7 +1370,7 @@ public:
             [&](const InquireStmt::Iolength &y) {
               Word("IOLENGTH="), Walk(y.t, ") ");
             },
-            [&](const std::list<InquireSpec> &y) { Walk(y, ", "), Put(')'); },
+            [&](const List<InquireSpec> &y) { Walk(y, ", "), Put(')'); },
         },
         x.u);
   }
@@ -1423,7 +1423,7 @@ public:
     std::visit(
         common::visitors{
             [&](const std::string &y) { PutNormalized(y); },
-            [&](const std::list<format::FormatItem> &y) {
+            [&](const List<format::FormatItem> &y) {
               Walk("(", y, ",", ")");
             },
             [&](const auto &y) { Walk(y); },
@@ -1532,8 +1532,8 @@ public:
     Word("USE"), Walk(", ", x.nature), Put(" :: "), Walk(x.moduleName);
     std::visit(
         common::visitors{
-            [&](const std::list<Rename> &y) { Walk(", ", y, ", "); },
-            [&](const std::list<Only> &y) { Walk(", ONLY: ", y, ", "); },
+            [&](const List<Rename> &y) { Walk(", ", y, ", "); },
+            [&](const List<Only> &y) { Walk(", ONLY: ", y, ", "); },
         },
         x.u);
   }
@@ -1583,7 +1583,7 @@ public:
       Word("MODULE ");
     }
     Word("PROCEDURE :: ");
-    Walk(std::get<std::list<Name>>(x.t), ", ");
+    Walk(std::get<List<Name>>(x.t), ", ");
   }
   void Before(const GenericSpec &x) {  // R1508, R1509
     std::visit(
@@ -1617,15 +1617,15 @@ public:
   void Unparse(const GenericStmt &x) {  // R1510
     Word("GENERIC"), Walk(", ", std::get<std::optional<AccessSpec>>(x.t));
     Put(" :: "), Walk(std::get<GenericSpec>(x.t)), Put(" => ");
-    Walk(std::get<std::list<Name>>(x.t), ", ");
+    Walk(std::get<List<Name>>(x.t), ", ");
   }
   void Unparse(const ExternalStmt &x) {  // R1511
     Word("EXTERNAL :: "), Walk(x.v, ", ");
   }
   void Unparse(const ProcedureDeclarationStmt &x) {  // R1512
     Word("PROCEDURE("), Walk(std::get<std::optional<ProcInterface>>(x.t));
-    Put(')'), Walk(", ", std::get<std::list<ProcAttrSpec>>(x.t), ", ");
-    Put(" :: "), Walk(std::get<std::list<ProcDecl>>(x.t), ", ");
+    Put(')'), Walk(", ", std::get<List<ProcAttrSpec>>(x.t), ", ");
+    Put(" :: "), Walk(std::get<List<ProcDecl>>(x.t), ", ");
   }
   void Unparse(const ProcDecl &x) {  // R1515
     Walk(std::get<Name>(x.t));
@@ -1636,11 +1636,11 @@ public:
   }
   void Unparse(const FunctionReference &x) {  // R1520
     Walk(std::get<ProcedureDesignator>(x.v.t));
-    Put('('), Walk(std::get<std::list<ActualArgSpec>>(x.v.t), ", "), Put(')');
+    Put('('), Walk(std::get<List<ActualArgSpec>>(x.v.t), ", "), Put(')');
   }
   void Unparse(const CallStmt &x) {  // R1521
     const auto &pd{std::get<ProcedureDesignator>(x.v.t)};
-    const auto &args{std::get<std::list<ActualArgSpec>>(x.v.t)};
+    const auto &args{std::get<List<ActualArgSpec>>(x.v.t)};
     Word("CALL "), Walk(pd);
     if (args.empty()) {
       if (std::holds_alternative<ProcComponentRef>(pd.u)) {
@@ -1670,9 +1670,9 @@ public:
   void Post(const PrefixSpec::Pure) { Word("PURE"); }
   void Post(const PrefixSpec::Recursive) { Word("RECURSIVE"); }
   void Unparse(const FunctionStmt &x) {  // R1530
-    Walk("", std::get<std::list<PrefixSpec>>(x.t), " ", " ");
+    Walk("", std::get<List<PrefixSpec>>(x.t), " ", " ");
     Word("FUNCTION "), Walk(std::get<Name>(x.t)), Put("(");
-    Walk(std::get<std::list<Name>>(x.t), ", "), Put(')');
+    Walk(std::get<List<Name>>(x.t), ", "), Put(')');
     Walk(" ", std::get<std::optional<Suffix>>(x.t)), Indent();
   }
   void Unparse(const Suffix &x) {  // R1532
@@ -1687,9 +1687,9 @@ public:
     EndSubprogram("FUNCTION", x.v);
   }
   void Unparse(const SubroutineStmt &x) {  // R1535
-    Walk("", std::get<std::list<PrefixSpec>>(x.t), " ", " ");
+    Walk("", std::get<List<PrefixSpec>>(x.t), " ", " ");
     Word("SUBROUTINE "), Walk(std::get<Name>(x.t));
-    const auto &args{std::get<std::list<DummyArg>>(x.t)};
+    const auto &args{std::get<List<DummyArg>>(x.t)};
     const auto &bind{std::get<std::optional<LanguageBindingSpec>>(x.t)};
     if (args.empty()) {
       Walk(" () ", bind);
@@ -1710,7 +1710,7 @@ public:
   }
   void Unparse(const EntryStmt &x) {  // R1541
     Word("ENTRY "), Walk(std::get<Name>(x.t)), Put("(");
-    Walk(std::get<std::list<DummyArg>>(x.t), ", "), Put(")");
+    Walk(std::get<List<DummyArg>>(x.t), ", "), Put(")");
     Walk(" ", std::get<std::optional<Suffix>>(x.t));
   }
   void Unparse(const ReturnStmt &x) {  // R1542
@@ -1723,7 +1723,7 @@ public:
   }
   void Unparse(const StmtFunctionStmt &x) {  // R1544
     Walk(std::get<Name>(x.t)), Put('(');
-    Walk(std::get<std::list<Name>>(x.t), ", "), Put(") = ");
+    Walk(std::get<List<Name>>(x.t), ", "), Put(") = ");
     Walk(std::get<Scalar<Expr>>(x.t));
   }
 
@@ -1731,17 +1731,17 @@ public:
   void Unparse(const CompilerDirective &x) {
     std::visit(
         common::visitors{
-            [&](const std::list<CompilerDirective::IgnoreTKR> &tkr) {
+            [&](const List<CompilerDirective::IgnoreTKR> &tkr) {
               Word("!DIR$ IGNORE_TKR");  // emitted even if tkr list is empty
               Walk(" ", tkr, ", ");
             },
-            [&](const std::list<Name> &names) { Walk("!DIR$ ", names, " "); },
+            [&](const List<Name> &names) { Walk("!DIR$ ", names, " "); },
         },
         x.u);
     Put('\n');
   }
   void Unparse(const CompilerDirective::IgnoreTKR &x) {
-    const auto &list{std::get<std::list<const char *>>(x.t)};
+    const auto &list{std::get<List<const char *>>(x.t)};
     if (!list.empty()) {
       Put("(");
       for (const char *tkr : list) {
@@ -1779,7 +1779,7 @@ public:
     Put(")");
   }
   void Unparse(const OmpAlignedClause &x) {
-    Word("ALIGNED("), Walk(std::get<std::list<Name>>(x.t), ",");
+    Word("ALIGNED("), Walk(std::get<List<Name>>(x.t), ",");
     Walk(std::get<std::optional<ScalarIntConstantExpr>>(x.t));
     Put(") ");
   }
@@ -1804,7 +1804,7 @@ public:
     Word("REDUCTION(");
     Walk(std::get<OmpReductionOperator>(x.t));
     Put(":");
-    Walk(std::get<std::list<Designator>>(x.t), ",");
+    Walk(std::get<List<Designator>>(x.t), ",");
     Put(")");
   }
   void Unparse(const OmpDependSinkVecLength &x) {
@@ -1819,7 +1819,7 @@ public:
     Put("(");
     Walk(std::get<OmpDependenceType>(x.t));
     Put(":");
-    Walk(std::get<std::list<Designator>>(x.t), ",");
+    Walk(std::get<List<Designator>>(x.t), ",");
     Put(")");
   }
   bool Pre(const OmpDependClause &x) {
@@ -2199,7 +2199,7 @@ public:
   }
   void Unparse(const OmpReductionCombiner::FunctionCombiner &x) {
     const auto &pd = std::get<ProcedureDesignator>(x.v.t);
-    const auto &args = std::get<std::list<ActualArgSpec>>(x.v.t);
+    const auto &args = std::get<List<ActualArgSpec>>(x.v.t);
     Walk(pd);
     if (args.empty()) {
       if (std::holds_alternative<ProcComponentRef>(pd.u)) {
@@ -2212,7 +2212,7 @@ public:
   void Unparse(const OpenMPDeclareReductionConstruct &x) {
     Put("(");
     Walk(std::get<OmpReductionOperator>(x.t)), Put(" : ");
-    Walk(std::get<std::list<DeclarationTypeSpec>>(x.t), ","), Put(" : ");
+    Walk(std::get<List<DeclarationTypeSpec>>(x.t), ","), Put(" : ");
     Walk(std::get<OmpReductionCombiner>(x.t));
     Put(")");
     Walk(std::get<std::optional<OmpReductionInitializerClause>>(x.t));
@@ -2352,7 +2352,7 @@ public:
   void Post(const StructureField &x) {
     if (const auto *def{std::get_if<Statement<DataComponentDefStmt>>(&x.u)}) {
       for (const auto &decl :
-          std::get<std::list<ComponentDecl>>(def->statement.t)) {
+          std::get<List<ComponentDecl>>(def->statement.t)) {
         structureComponents_.insert(std::get<Name>(decl.t).source);
       }
     }
@@ -2361,9 +2361,9 @@ public:
     Word("STRUCTURE ");
     if (std::get<bool>(x.t)) {  // slashes around name
       Put('/'), Walk(std::get<Name>(x.t)), Put('/');
-      Walk(" ", std::get<std::list<EntityDecl>>(x.t), ", ");
+      Walk(" ", std::get<List<EntityDecl>>(x.t), ", ");
     } else {
-      CHECK(std::get<std::list<EntityDecl>>(x.t).empty());
+      CHECK(std::get<List<EntityDecl>>(x.t).empty());
       Walk(std::get<Name>(x.t));
     }
     Indent();
@@ -2390,7 +2390,7 @@ public:
   }
   void Unparse(const AssignedGotoStmt &x) {
     Word("GO TO "), Walk(std::get<Name>(x.t));
-    Walk(", (", std::get<std::list<Label>>(x.t), ", ", ")");
+    Walk(", (", std::get<List<Label>>(x.t), ", ", ")");
   }
   void Unparse(const PauseStmt &x) { Word("PAUSE"), Walk(" ", x.v); }
 
@@ -2458,10 +2458,10 @@ private:
     return Walk("", x, suffix);
   }
 
-  // Traverse a std::list<>.  Separate the elements with an optional string.
+  // Traverse a List<>.  Separate the elements with an optional string.
   // Emit a prefix and/or a suffix string only when the list is not empty.
   template<typename A>
-  void Walk(const char *prefix, const std::list<A> &list,
+  void Walk(const char *prefix, const List<A> &list,
       const char *comma = ", ", const char *suffix = "") {
     if (!list.empty()) {
       const char *str{prefix};
@@ -2473,7 +2473,7 @@ private:
     }
   }
   template<typename A>
-  void Walk(const std::list<A> &list, const char *comma = ", ",
+  void Walk(const List<A> &list, const char *comma = ", ",
       const char *suffix = "") {
     return Walk("", list, comma, suffix);
   }
@@ -89,7 +89,7 @@ std::optional<DataComponentDefStmt> StructureComponents::Parse(
   std::optional<DataComponentDefStmt> defs{stmt.Parse(state)};
   if (defs) {
     if (auto *ustate{state.userState()}) {
-      for (const auto &decl : std::get<std::list<ComponentDecl>>(defs->t)) {
+      for (const auto &decl : std::get<List<ComponentDecl>>(defs->t)) {
         ustate->NoteOldStructureComponent(std::get<Name>(decl.t).source);
       }
     }
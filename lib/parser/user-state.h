@@ -34,6 +34,8 @@ namespace Fortran::parser {
 
 class CookedSource;
 class ParsingLog;
+class ParseMemoTable;
+class ParserProfile;
 class ParseState;
 
 class Success {};  // for when one must return something that's present
@@ -64,6 +66,18 @@ public:
     return *this;
   }
 
+  ParseMemoTable *memoTable() const { return memoTable_; }
+  UserState &set_memoTable(ParseMemoTable *table) {
+    memoTable_ = table;
+    return *this;
+  }
+
+  ParserProfile *parserProfile() const { return parserProfile_; }
+  UserState &set_parserProfile(ParserProfile *profile) {
+    parserProfile_ = profile;
+    return *this;
+  }
+
   void NewSubprogram() {
     doLabels_.clear();
     nonlabelDoConstructNestingDepth_ = 0;
@@ -102,6 +116,10 @@ private:
   ParsingLog *log_{nullptr};
   bool instrumentedParse_{false};
 
+  ParseMemoTable *memoTable_{nullptr};
+
+  ParserProfile *parserProfile_{nullptr};
+
   std::unordered_map<Label, int> doLabels_;
   int nonlabelDoConstructNestingDepth_{0};
 
@@ -423,11 +423,11 @@ void AssignmentContext::Analyze(const parser::WhereConstruct &construct) {
   }
   AssignmentContext nested{*this, where};
   for (const auto &x :
-      std::get<std::list<parser::WhereBodyConstruct>>(construct.t)) {
+      std::get<parser::List<parser::WhereBodyConstruct>>(construct.t)) {
     nested.Analyze(x);
   }
   for (const auto &x :
-      std::get<std::list<parser::WhereConstruct::MaskedElsewhere>>(
+      std::get<parser::List<parser::WhereConstruct::MaskedElsewhere>>(
           construct.t)) {
     nested.Analyze(x);
   }
@@ -462,7 +462,7 @@ void AssignmentContext::Analyze(const parser::ForallConstruct &construct) {
   nested.Analyze(std::get<common::Indirection<parser::ConcurrentHeader>>(
       forallStmt.statement.t));
   for (const auto &body :
-      std::get<std::list<parser::ForallBodyConstruct>>(construct.t)) {
+      std::get<parser::List<parser::ForallBodyConstruct>>(construct.t)) {
     nested.Analyze(body.u);
   }
 }
@@ -496,7 +496,7 @@ void AssignmentContext::Analyze(
         "with the mask of the surrounding WHERE construct"_err_en_US);
   }
   for (const auto &x :
-      std::get<std::list<parser::WhereBodyConstruct>>(elsewhere.t)) {
+      std::get<parser::List<parser::WhereBodyConstruct>>(elsewhere.t)) {
     Analyze(x);
   }
 }
@@ -506,7 +506,7 @@ void AssignmentContext::Analyze(
   MaskExpr copyCumulative{DEREF(where_).cumulativeMaskExpr};
   where_->thisMaskExpr = evaluate::LogicalNegation(std::move(copyCumulative));
   for (const auto &x :
-      std::get<std::list<parser::WhereBodyConstruct>>(elsewhere.t)) {
+      std::get<parser::List<parser::WhereBodyConstruct>>(elsewhere.t)) {
     Analyze(x);
   }
 }
@@ -515,7 +515,7 @@ void AssignmentContext::Analyze(const parser::ConcurrentHeader &header) {
   DEREF(forall_).integerKind = GetIntegerKind(
       std::get<std::optional<parser::IntegerTypeSpec>>(header.t));
   for (const auto &control :
-      std::get<std::list<parser::ConcurrentControl>>(header.t)) {
+      std::get<parser::List<parser::ConcurrentControl>>(header.t)) {
     const parser::Name &name{std::get<parser::Name>(control.t)};
     bool inserted{forall_->activeNames.insert(name.source).second};
     CHECK(inserted || context_.HasError(name));
@@ -28,7 +28,7 @@ public:
   template<typename T> void Post(T &) {}
   void Post(Block &block) {
     std::vector<LabelInfo> stack;
-    for (auto i{block.begin()}, end{block.end()}; i != end; ++i) {
+    for (auto i{block.begin()}; i != block.end(); ++i) {
       if (auto *executableConstruct{std::get_if<ExecutableConstruct>(&i->u)}) {
         std::visit(
             common::visitors{
@@ -118,7 +118,8 @@ private:
             std::get<Statement<common::Indirection<LabelDoStmt>>>(
                 std::get<ExecutableConstruct>(doLoop->u).u)
                 .source};
-        block.splice(block.begin(), originalBlock, ++stack.back().iter, next);
+        block.splice(block.begin(), originalBlock, std::next(doLoop), next);
+        next = std::next(doLoop);  // the splice invalidated next
         auto &labelDo{std::get<Statement<common::Indirection<LabelDoStmt>>>(
             std::get<ExecutableConstruct>(doLoop->u).u)};
         auto &loopControl{
@@ -61,14 +61,14 @@ private:
 
   static int ShapeSpecRank(const parser::Allocation &allocation) {
     return static_cast<int>(
-        std::get<std::list<parser::AllocateShapeSpec>>(allocation.t).size());
+        std::get<parser::List<parser::AllocateShapeSpec>>(allocation.t).size());
   }
 
   static int CoarraySpecRank(const parser::Allocation &allocation) {
     if (const auto &coarraySpec{
             std::get<std::optional<parser::AllocateCoarraySpec>>(
                 allocation.t)}) {
-      return std::get<std::list<parser::AllocateCoshapeSpec>>(coarraySpec->t)
+      return std::get<parser::List<parser::AllocateCoshapeSpec>>(coarraySpec->t)
                  .size() +
           1;
     } else {
@@ -132,7 +132,7 @@ static std::optional<AllocateCheckerInfo> CheckAllocateOptions(
 
   const parser::Expr *parserSourceExpr{nullptr};
   for (const parser::AllocOpt &allocOpt :
-      std::get<std::list<parser::AllocOpt>>(allocateStmt.t)) {
+      std::get<parser::List<parser::AllocOpt>>(allocateStmt.t)) {
     std::visit(
         common::visitors{
             [&](const parser::StatOrErrmsg &statOrErr) {
@@ -617,7 +617,7 @@ bool AllocationCheckerHelper::RunCoarrayRelatedChecks(
 void AllocateChecker::Leave(const parser::AllocateStmt &allocateStmt) {
   if (auto info{CheckAllocateOptions(allocateStmt, context_)}) {
     for (const parser::Allocation &allocation :
-        std::get<std::list<parser::Allocation>>(allocateStmt.t)) {
+        std::get<parser::List<parser::Allocation>>(allocateStmt.t)) {
       AllocationCheckerHelper{allocation, *info}.RunChecks(context_);
     }
   }
@@ -38,7 +38,8 @@ static void CheckTeamType(SemanticsContext &context, const T &x) {
 }
 
 void CoarrayChecker::Leave(const parser::ChangeTeamStmt &x) {
-  CheckNamesAreDistinct(std::get<std::list<parser::CoarrayAssociation>>(x.t));
+  CheckNamesAreDistinct(
+      std::get<parser::List<parser::CoarrayAssociation>>(x.t));
   CheckTeamType(context_, std::get<parser::TeamValue>(x.t));
 }
 
@@ -58,7 +59,7 @@ void CoarrayChecker::Leave(const parser::FormTeamStmt &x) {
 
 // Check that coarray names and selector names are all distinct.
 void CoarrayChecker::CheckNamesAreDistinct(
-    const std::list<parser::CoarrayAssociation> &list) {
+    const parser::List<parser::CoarrayAssociation> &list) {
   std::set<parser::CharBlock> names;
   auto getPreviousUse{
       [&](const parser::Name &name) -> const parser::CharBlock * {
@@ -16,7 +16,7 @@
 #define FORTRAN_SEMANTICS_CHECK_COARRAY_H_
 
 #include "semantics.h"
-#include <list>
+#include "../parser/list.h"
 
 namespace Fortran::parser {
 class CharBlock;
@@ -42,7 +42,7 @@ public:
 private:
   SemanticsContext &context_;
 
-  void CheckNamesAreDistinct(const std::list<parser::CoarrayAssociation> &);
+  void CheckNamesAreDistinct(const parser::List<parser::CoarrayAssociation> &);
   void Say2(const parser::CharBlock &, parser::MessageFixedText &&,
       const parser::CharBlock &, parser::MessageFixedText &&);
 };
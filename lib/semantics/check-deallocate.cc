@@ -22,7 +22,7 @@ namespace Fortran::semantics {
 
 void DeallocateChecker::Leave(const parser::DeallocateStmt &deallocateStmt) {
   for (const parser::AllocateObject &allocateObject :
-      std::get<std::list<parser::AllocateObject>>(deallocateStmt.t)) {
+      std::get<parser::List<parser::AllocateObject>>(deallocateStmt.t)) {
     std::visit(
         common::visitors{
             [&](const parser::Name &name) {
@@ -52,7 +52,7 @@ void DeallocateChecker::Leave(const parser::DeallocateStmt &deallocateStmt) {
   }
   bool gotStat{false}, gotMsg{false};
   for (const parser::StatOrErrmsg &deallocOpt :
-      std::get<std::list<parser::StatOrErrmsg>>(deallocateStmt.t)) {
+      std::get<parser::List<parser::StatOrErrmsg>>(deallocateStmt.t)) {
     std::visit(
         common::visitors{
             [&](const parser::StatVariable &) {
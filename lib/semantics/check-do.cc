@@ -239,7 +239,7 @@ public:
 
   void Post(const parser::GotoStmt &gotoStmt) { checkLabelUse(gotoStmt.v); }
   void Post(const parser::ComputedGotoStmt &computedGotoStmt) {
-    for (auto &i : std::get<std::list<parser::Label>>(computedGotoStmt.t)) {
+    for (auto &i : std::get<parser::List<parser::Label>>(computedGotoStmt.t)) {
       checkLabelUse(i);
     }
   }
@@ -255,7 +255,7 @@ public:
   }
 
   void Post(const parser::AssignedGotoStmt &assignedGotoStmt) {
-    for (auto &i : std::get<std::list<parser::Label>>(assignedGotoStmt.t)) {
+    for (auto &i : std::get<parser::List<parser::Label>>(assignedGotoStmt.t)) {
       checkLabelUse(i);
     }
   }
@@ -435,7 +435,7 @@ private:
   // the local versions of them.  Then follow the host-, use-, and
   // construct-associations to get the root symbols
   SymbolSet GatherLocals(
-      const std::list<parser::LocalitySpec> &localitySpecs) const {
+      const parser::List<parser::LocalitySpec> &localitySpecs) const {
     SymbolSet symbols;
     const Scope &parentScope{
         context_.FindScope(currentStatementSourcePosition_).parent()};
@@ -529,7 +529,7 @@ private:
   // C1130, DEFAULT(NONE) locality requires names to be in locality-specs to
   // be used in the body of the DO loop
   void CheckDefaultNoneImpliesExplicitLocality(
-      const std::list<parser::LocalitySpec> &localitySpecs,
+      const parser::List<parser::LocalitySpec> &localitySpecs,
       const parser::Block &block) const {
     bool hasDefaultNone{false};
     for (auto &ls : localitySpecs) {
@@ -552,7 +552,7 @@ private:
 
   // C1123, concurrent limit or step expressions can't reference index-names
   void CheckConcurrentHeader(const parser::ConcurrentHeader &header) const {
-    auto &controls{std::get<std::list<parser::ConcurrentControl>>(header.t)};
+    auto &controls{std::get<parser::List<parser::ConcurrentControl>>(header.t)};
     SymbolSet indexNames;
     for (const auto &c : controls) {
       const auto &indexName{std::get<parser::Name>(c.t)};
@@ -576,9 +576,9 @@ private:
       const parser::Block &block) const {
     const auto &header{std::get<parser::ConcurrentHeader>(concurrent.t)};
     const auto &controls{
-        std::get<std::list<parser::ConcurrentControl>>(header.t)};
+        std::get<parser::List<parser::ConcurrentControl>>(header.t)};
     const auto &localitySpecs{
-        std::get<std::list<parser::LocalitySpec>>(concurrent.t)};
+        std::get<parser::List<parser::LocalitySpec>>(concurrent.t)};
     if (!localitySpecs.empty()) {
       const SymbolSet &localVars{GatherLocals(localitySpecs)};
       for (const auto &c : controls) {
@@ -457,7 +457,7 @@ void IoChecker::Leave(const parser::FlushStmt &) {
 }
 
 void IoChecker::Leave(const parser::InquireStmt &stmt) {
-  if (std::get_if<std::list<parser::InquireSpec>>(&stmt.u)) {
+  if (std::get_if<parser::List<parser::InquireSpec>>(&stmt.u)) {
     CheckForPureSubprogram();
     // Inquire by unit or by file (vs. by output list).
     CheckForRequiredSpecifier(
@@ -25,16 +25,16 @@ void PurityChecker::Enter(const parser::ExecutableConstruct &exec) {
 }
 void PurityChecker::Enter(const parser::SubroutineSubprogram &subr) {
   const auto &stmt{std::get<parser::Statement<parser::SubroutineStmt>>(subr.t)};
-  Entered(
-      stmt.source, std::get<std::list<parser::PrefixSpec>>(stmt.statement.t));
+  Entered(stmt.source,
+      std::get<parser::List<parser::PrefixSpec>>(stmt.statement.t));
 }
 
 void PurityChecker::Leave(const parser::SubroutineSubprogram &) { Left(); }
 
 void PurityChecker::Enter(const parser::FunctionSubprogram &func) {
   const auto &stmt{std::get<parser::Statement<parser::FunctionStmt>>(func.t)};
-  Entered(
-      stmt.source, std::get<std::list<parser::PrefixSpec>>(stmt.statement.t));
+  Entered(stmt.source,
+      std::get<parser::List<parser::PrefixSpec>>(stmt.statement.t));
 }
 
 void PurityChecker::Leave(const parser::FunctionSubprogram &) { Left(); }
@@ -44,7 +44,7 @@ bool PurityChecker::InPureSubprogram() const {
 }
 
 bool PurityChecker::HasPurePrefix(
-    const std::list<parser::PrefixSpec> &prefixes) const {
+    const parser::List<parser::PrefixSpec> &prefixes) const {
   for (const parser::PrefixSpec &prefix : prefixes) {
     if (std::holds_alternative<parser::PrefixSpec::Pure>(prefix.u)) {
       return true;
@@ -53,8 +53,8 @@ bool PurityChecker::HasPurePrefix(
   return false;
 }
 
-void PurityChecker::Entered(
-    parser::CharBlock source, const std::list<parser::PrefixSpec> &prefixes) {
+void PurityChecker::Entered(parser::CharBlock source,
+    const parser::List<parser::PrefixSpec> &prefixes) {
   if (depth_ == 2) {
     context_.messages().Say(source,
         "An internal subprogram may not contain an internal subprogram"_err_en_US);
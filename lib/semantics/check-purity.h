@@ -15,7 +15,7 @@
 #ifndef FORTRAN_SEMANTICS_CHECK_PURITY_H_
 #define FORTRAN_SEMANTICS_CHECK_PURITY_H_
 #include "semantics.h"
-#include <list>
+#include "../parser/list.h"
 namespace Fortran::parser {
 struct ExecutableConstruct;
 struct SubroutineSubprogram;
@@ -34,8 +34,8 @@ public:
 
 private:
   bool InPureSubprogram() const;
-  bool HasPurePrefix(const std::list<parser::PrefixSpec> &) const;
-  void Entered(parser::CharBlock, const std::list<parser::PrefixSpec> &);
+  bool HasPurePrefix(const parser::List<parser::PrefixSpec> &) const;
+  void Entered(parser::CharBlock, const parser::List<parser::PrefixSpec> &);
   void Left();
   SemanticsContext &context_;
   int depth_{0};
@@ -848,7 +848,7 @@ std::optional<Subscript> ExpressionAnalyzer::AnalyzeSectionSubscript(
 
 // Empty result means an error occurred
 std::vector<Subscript> ExpressionAnalyzer::AnalyzeSectionSubscripts(
-    const std::list<parser::SectionSubscript> &sss) {
+    const parser::List<parser::SectionSubscript> &sss) {
   std::vector<Subscript> subscripts;
   for (const auto &s : sss) {
     if (auto subscript{AnalyzeSectionSubscript(s)}) {
@@ -1018,7 +1018,7 @@ MaybeExpr ExpressionAnalyzer::Analyze(const parser::CoindexedNamedObject &x) {
     std::vector<Expr<SubscriptInteger>> cosubscripts;
     bool cosubsOk{true};
     for (const auto &cosub :
-        std::get<std::list<parser::Cosubscript>>(x.imageSelector.t)) {
+        std::get<parser::List<parser::Cosubscript>>(x.imageSelector.t)) {
       MaybeExpr coex{Analyze(cosub)};
       if (auto *intExpr{UnwrapExpr<Expr<SomeInteger>>(coex)}) {
         cosubscripts.push_back(
@@ -1210,7 +1210,7 @@ void ArrayConstructorContext::Add(const parser::AcValue &x) {
                 GetSpecificIntExpr<IntType::kind>(bounds.step)};
             ArrayConstructorContext nested{*this};
             for (const auto &value :
-                std::get<std::list<parser::AcValue>>(impliedDo.value().t)) {
+                std::get<parser::List<parser::AcValue>>(impliedDo.value().t)) {
               nested.Add(value);
             }
             if (lower && upper) {
@@ -1336,7 +1336,7 @@ MaybeExpr ExpressionAnalyzer::Analyze(
   bool checkConflicts{true};  // until we hit one
 
   for (const auto &component :
-      std::get<std::list<parser::ComponentSpec>>(structure.t)) {
+      std::get<parser::List<parser::ComponentSpec>>(structure.t)) {
     const parser::Expr &expr{
         std::get<parser::ComponentDataSource>(component.t).v.value()};
     parser::CharBlock source{expr.source};
@@ -1765,7 +1765,8 @@ MaybeExpr ExpressionAnalyzer::AnalyzeCall(
     const parser::Call &call, bool isSubroutine) {
   auto save{GetContextualMessages().SetLocation(call.source)};
   ArgumentAnalyzer analyzer{*this};
-  for (const auto &arg : std::get<std::list<parser::ActualArgSpec>>(call.t)) {
+  for (const auto &arg :
+      std::get<parser::List<parser::ActualArgSpec>>(call.t)) {
     analyzer.Analyze(arg, isSubroutine);
   }
   if (!analyzer.fatalErrors()) {
@@ -2111,7 +2112,7 @@ static void CheckFuncRefToArrayElementRefHasSubscripts(
   // reference with no subscripts because it will not be possible to later tell
   // the difference in expressions between empty subscript list due to bad
   // subscripts error recovery or because the user did not put any.
-  if (std::get<std::list<parser::ActualArgSpec>>(funcRef.v.t).empty()) {
+  if (std::get<parser::List<parser::ActualArgSpec>>(funcRef.v.t).empty()) {
     auto &proc{std::get<parser::ProcedureDesignator>(funcRef.v.t)};
     const auto *name{std::get_if<parser::Name>(&proc.u)};
     if (!name) {
@@ -19,6 +19,7 @@
 #include "symbol.h"
 #include "tools.h"
 #include "../evaluate/tools.h"
+#include "../parser/characters.h"
 #include "../parser/message.h"
 #include "../parser/parsing.h"
 #include <algorithm>
@@ -68,7 +69,8 @@ static std::ostream &PutAttrs(std::ostream &, Attrs,
 static std::ostream &PutAttr(std::ostream &, Attr);
 static std::ostream &PutType(std::ostream &, const DeclTypeSpec &);
 static std::ostream &PutLower(std::ostream &, const std::string &);
-static int WriteFile(const std::string &, const std::string &);
+static int WriteFile(
+    const std::string &, const std::string &, bool withHeader = true);
 static bool FileContentsMatch(
     const std::string &, const std::string &, const std::string &);
 static std::size_t GetFileSize(const std::string &);
@@ -141,10 +143,76 @@ void ModFileWriter::Write(const Symbol &symbol) {
   auto path{context_.moduleDirectory() + '/' +
       ModFileName(symbol.name(), ancestorName, context_.moduleFileSuffix())};
   PutSymbols(DEREF(symbol.scope()));
-  if (int error{WriteFile(path, GetAsString(symbol))}) {
+  auto contents{GetAsString(symbol)};
+  if (int error{WriteFile(path, contents)}) {
     context_.Say(symbol.name(), "Error writing %s: %s"_err_en_US, path,
         std::strerror(error));
   }
+  if (context_.writeInterfaceHashes()) {
+    // Written only when changed, so that a build system can make the
+    // users of a module depend on it rather than on the module file.
+    // A submodule cannot be used, so all of it is interface to its
+    // descendants.
+    auto hashPath{path + ".ihash"};
+    auto visible{ancestor ? contents : GetInterface(symbol)};
+    if (int error{WriteFile(hashPath,
+            CheckSum(visible) + ModHeader::terminator,
+            false /*withHeader*/)}) {
+      context_.Say(symbol.name(), "Error writing %s: %s"_err_en_US,
+          hashPath, std::strerror(error));
+    }
+  }
+}
+
+static std::set<std::string> IdentifiersIn(const std::string &text) {
+  std::set<std::string> result;
+  for (std::size_t j{0}; j < text.size();) {
+    if (parser::IsLegalIdentifierStart(text[j])) {
+      std::size_t start{j};
+      while (j < text.size() && parser::IsLegalInIdentifier(text[j])) {
+        ++j;
+      }
+      result.insert(text.substr(start, j - start));
+    } else {
+      ++j;
+    }
+  }
+  return result;
+}
+
+// The interface of a module comprises what its users can see: the text
+// of its module file less the private entities that no public one refers
+// to, which are there only for the sake of its submodules.
+std::string ModFileWriter::GetInterface(const Symbol &symbol) {
+  std::string result{"module " + symbol.name().ToString() + '\n'};
+  std::vector<std::pair<std::string, std::string>> privates;  // name, text
+  for (const Symbol &x : CollectSymbols(DEREF(symbol.scope()))) {
+    ModFileWriter writer{context_};
+    std::stringstream typeBindings;
+    writer.PutSymbol(typeBindings, x);
+    auto text{writer.uses_.str() + writer.useExtraAttrs_.str() +
+        writer.decls_.str() + writer.contains_.str()};
+    if (x.attrs().test(Attr::PRIVATE)) {
+      privates.emplace_back(x.name().ToString(), std::move(text));
+    } else {
+      result += text;
+    }
+  }
+  // Add private entities to which the interface refers, directly or not.
+  for (bool any{true}; any;) {
+    any = false;
+    auto names{IdentifiersIn(result)};
+    for (auto iter{privates.begin()}; iter != privates.end();) {
+      if (names.find(iter->first) != names.end()) {
+        result += iter->second;
+        iter = privates.erase(iter);
+        any = true;
+      } else {
+        ++iter;
+      }
+    }
+  }
+  return result;
 }
 
 // Return the entire body of the module file
@@ -650,9 +718,11 @@ static Temp MkTemp(const std::string &path) {
 
 // Write the module file at path, prepending header. If an error occurs,
 // return errno, otherwise 0.
-static int WriteFile(const std::string &path, const std::string &contents) {
-  auto header{std::string{ModHeader::bom} + ModHeader::magic +
-      CheckSum(contents) + ModHeader::terminator};
+static int WriteFile(
+    const std::string &path, const std::string &contents, bool withHeader) {
+  auto header{withHeader ? std::string{ModHeader::bom} + ModHeader::magic +
+          CheckSum(contents) + ModHeader::terminator
+                         : ""s};
   if (FileContentsMatch(path, header, contents)) {
     return 0;
   }
@@ -754,6 +824,8 @@ Scope *ModFileReader::Read(const SourceName &name, Scope *ancestor) {
     auto it{context_.globalScope().find(name)};
     if (it != context_.globalScope().end()) {
       return it->second->scope();
+    } else if (auto *symbol{context_.RestoreModFileModule(name)}) {
+      return symbol->scope();
     }
   }
   parser::Parsing parsing{context_.allSources()};
@@ -762,7 +834,17 @@ Scope *ModFileReader::Read(const SourceName &name, Scope *ancestor) {
   options.features.Enable(common::LanguageFeature::BackslashEscapes);
   options.searchDirectories = context_.searchDirectories();
   auto path{ModFileName(name, ancestorName, context_.moduleFileSuffix())};
-  const auto *sourceFile{parsing.Prescan(path, options)};
+  std::string parseTreeFile;
+  const parser::SourceFile *sourceFile{nullptr};
+  if (!context_.parseTreeDirectory().empty()) {
+    parseTreeFile = parser::ParseTreeFileName(
+        context_.parseTreeDirectory(), path, options);
+    sourceFile = parsing.LoadParseTree(parseTreeFile, path, options);
+  }
+  bool loaded{sourceFile != nullptr};
+  if (!loaded) {
+    sourceFile = parsing.Prescan(path, options);
+  }
   if (!sourceFile) {
     return nullptr;
   } else if (parsing.messages().AnyFatalError()) {
@@ -778,7 +860,9 @@ Scope *ModFileReader::Read(const SourceName &name, Scope *ancestor) {
     return nullptr;
   }
 
-  parsing.Parse(nullptr);
+  if (!loaded) {
+    parsing.Parse(nullptr);
+  }
   auto &parseTree{parsing.parseTree()};
   if (!parsing.messages().empty() || !parsing.consumedWholeFile() ||
       !parseTree) {
@@ -786,6 +870,9 @@ Scope *ModFileReader::Read(const SourceName &name, Scope *ancestor) {
         sourceFile->path());
     return nullptr;
   }
+  if (!loaded && !parseTreeFile.empty()) {
+    parsing.SaveParseTree(parseTreeFile);
+  }
   Scope *parentScope;  // the scope this module/submodule goes into
   if (!ancestor) {
     parentScope = &context_.globalScope();
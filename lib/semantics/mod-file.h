@@ -48,6 +48,7 @@ private:
   void WriteOne(const Scope &);
   void Write(const Symbol &);
   std::string GetAsString(const Symbol &);
+  std::string GetInterface(const Symbol &);
   void PutSymbols(const Scope &);
   void PutSymbol(std::stringstream &, const Symbol &);
   void PutDerivedType(const Symbol &);
@@ -28,7 +28,7 @@ static ProgramTree BuildSubprogramTree(const parser::Name &name, const T &x) {
   ProgramTree node{name, spec, &exec};
   if (subps) {
     for (const auto &subp :
-        std::get<std::list<parser::InternalSubprogram>>(subps->t)) {
+        std::get<parser::List<parser::InternalSubprogram>>(subps->t)) {
       std::visit(
           [&](const auto &y) { node.AddChild(ProgramTree::Build(y.value())); },
           subp.u);
@@ -44,7 +44,7 @@ static ProgramTree BuildModuleTree(const parser::Name &name, const T &x) {
   ProgramTree node{name, spec};
   if (subps) {
     for (const auto &subp :
-        std::get<std::list<parser::ModuleSubprogram>>(subps->t)) {
+        std::get<parser::List<parser::ModuleSubprogram>>(subps->t)) {
       std::visit(
           [&](const auto &y) { node.AddChild(ProgramTree::Build(y.value())); },
           subp.u);
@@ -124,7 +124,7 @@ Symbol::Flag ProgramTree::GetSubpFlag() const {
 }
 
 bool ProgramTree::HasModulePrefix() const {
-  using ListType = std::list<parser::PrefixSpec>;
+  using ListType = parser::List<parser::PrefixSpec>;
   const auto *prefixes{std::visit(
       common::visitors{
           [](const parser::Statement<parser::FunctionStmt> *x) {
@@ -463,7 +463,8 @@ public:
   }
   void Post(const parser::GotoStmt &gotoStmt) { AddLabelReference(gotoStmt.v); }
   void Post(const parser::ComputedGotoStmt &computedGotoStmt) {
-    AddLabelReference(std::get<std::list<parser::Label>>(computedGotoStmt.t));
+    AddLabelReference(
+        std::get<parser::List<parser::Label>>(computedGotoStmt.t));
   }
   void Post(const parser::ArithmeticIfStmt &arithmeticIfStmt) {
     AddLabelReference(std::get<1>(arithmeticIfStmt.t));
@@ -474,7 +475,8 @@ public:
     AddLabelReference(std::get<parser::Label>(assignStmt.t));
   }
   void Post(const parser::AssignedGotoStmt &assignedGotoStmt) {
-    AddLabelReference(std::get<std::list<parser::Label>>(assignedGotoStmt.t));
+    AddLabelReference(
+        std::get<parser::List<parser::Label>>(assignedGotoStmt.t));
   }
   void Post(const parser::AltReturnSpec &altReturnSpec) {
     AddLabelReference(altReturnSpec.v);
@@ -579,7 +581,7 @@ private:
       typename CONSTRUCT>
   void CheckSelectNames(const char *tag, const CONSTRUCT &construct) {
     CheckEndName<FIRST, parser::EndSelectStmt>(tag, construct);
-    for (const auto &inner : std::get<std::list<CASEBLOCK>>(construct.t)) {
+    for (const auto &inner : std::get<parser::List<CASEBLOCK>>(construct.t)) {
       CheckOptionalName<FIRST>(
           tag, construct, std::get<parser::Statement<CASE>>(inner.t));
     }
@@ -682,7 +684,8 @@ private:
   void CheckName(const parser::IfConstruct &ifConstruct) {
     CheckEndName<parser::IfThenStmt, parser::EndIfStmt>("IF", ifConstruct);
     for (const auto &elseIfBlock :
-        std::get<std::list<parser::IfConstruct::ElseIfBlock>>(ifConstruct.t)) {
+        std::get<parser::List<parser::IfConstruct::ElseIfBlock>>(
+            ifConstruct.t)) {
       CheckOptionalName<parser::IfThenStmt>("IF construct", ifConstruct,
           std::get<parser::Statement<parser::ElseIfStmt>>(elseIfBlock.t));
     }
@@ -699,7 +702,7 @@ private:
     CheckEndName<parser::WhereConstructStmt, parser::EndWhereStmt>(
         "WHERE", whereConstruct);
     for (const auto &maskedElsewhere :
-        std::get<std::list<parser::WhereConstruct::MaskedElsewhere>>(
+        std::get<parser::List<parser::WhereConstruct::MaskedElsewhere>>(
             whereConstruct.t)) {
       CheckOptionalName<parser::WhereConstructStmt>("WHERE construct",
           whereConstruct,
@@ -770,7 +773,7 @@ private:
         label, currentScope_, currentPosition_);
   }
 
-  void AddLabelReference(const std::list<parser::Label> &labels) {
+  void AddLabelReference(const parser::List<parser::Label> &labels) {
     for (const parser::Label &label : labels) {
       AddLabelReference(label);
     }
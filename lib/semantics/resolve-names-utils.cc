@@ -217,7 +217,7 @@ private:
   SemanticsContext &context_;
   ArraySpec arraySpec_;
 
-  template<typename T> void Analyze(const std::list<T> &list) {
+  template<typename T> void Analyze(const parser::List<T> &list) {
     for (const auto &elem : list) {
       Analyze(elem);
     }
@@ -257,7 +257,7 @@ ArraySpec ArraySpecAnalyzer::Analyze(const parser::ArraySpec &x) {
   std::visit(
       common::visitors{
           [&](const parser::AssumedSizeSpec &y) {
-            Analyze(std::get<std::list<parser::ExplicitShapeSpec>>(y.t));
+            Analyze(std::get<parser::List<parser::ExplicitShapeSpec>>(y.t));
             Analyze(std::get<parser::AssumedImpliedSpec>(y.t));
           },
           [&](const parser::ImpliedShapeSpec &y) { Analyze(y.v); },
@@ -272,7 +272,7 @@ ArraySpec ArraySpecAnalyzer::Analyze(const parser::CoarraySpec &x) {
       common::visitors{
           [&](const parser::DeferredCoshapeSpecList &y) { MakeDeferred(y.v); },
           [&](const parser::ExplicitCoshapeSpec &y) {
-            Analyze(std::get<std::list<parser::ExplicitShapeSpec>>(y.t));
+            Analyze(std::get<parser::List<parser::ExplicitShapeSpec>>(y.t));
             MakeImplied(
                 std::get<std::optional<parser::SpecificationExpr>>(y.t));
           },
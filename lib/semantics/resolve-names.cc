@@ -373,7 +373,7 @@ private:
   std::optional<SourceName> prevImplicitNoneType_;
   std::optional<SourceName> prevParameterStmt_;
 
-  bool HandleImplicitNone(const std::list<ImplicitNoneNameSpec> &nameSpecs);
+  bool HandleImplicitNone(const parser::List<ImplicitNoneNameSpec> &nameSpecs);
 };
 
 // Track array specifications. They can occur in AttrSpec, EntityDecl,
@@ -628,7 +628,7 @@ private:
   std::multimap<Symbol *, std::pair<const parser::Name *, ProcedureKind>>
       specificProcs_;
 
-  void AddSpecificProcs(const std::list<parser::Name> &, ProcedureKind);
+  void AddSpecificProcs(const parser::List<parser::Name> &, ProcedureKind);
   void ResolveSpecificsInGeneric(Symbol &generic);
   void SayNotDistinguishable(const Symbol &, const Symbol &, const Symbol &);
 };
@@ -829,7 +829,7 @@ private:
     const Symbol *type{nullptr};  // derived type being defined
   } derivedTypeInfo_;
   // Collect equivalence sets and process at end of specification part
-  std::vector<const std::list<parser::EquivalenceObject> *> equivalenceSets_;
+  std::vector<const parser::List<parser::EquivalenceObject> *> equivalenceSets_;
   // Info about common blocks in the current scope
   struct {
     Symbol *curr{nullptr};  // common block currently being processed
@@ -852,7 +852,7 @@ private:
     std::optional<int> value{0};
   } enumerationState_;
 
-  bool HandleAttributeStmt(Attr, const std::list<parser::Name> &);
+  bool HandleAttributeStmt(Attr, const parser::List<parser::Name> &);
   Symbol &HandleAttributeStmt(Attr, const parser::Name &);
   Symbol &DeclareUnknownEntity(const parser::Name &, Attrs);
   Symbol &DeclareProcEntity(const parser::Name &, Attrs, const ProcInterface &);
@@ -1662,10 +1662,10 @@ void ImplicitRulesVisitor::Post(const parser::ParameterStmt &) {
 bool ImplicitRulesVisitor::Pre(const parser::ImplicitStmt &x) {
   bool result{std::visit(
       common::visitors{
-          [&](const std::list<ImplicitNoneNameSpec> &y) {
+          [&](const parser::List<ImplicitNoneNameSpec> &y) {
             return HandleImplicitNone(y);
           },
-          [&](const std::list<parser::ImplicitSpec> &) {
+          [&](const parser::List<parser::ImplicitSpec> &) {
             if (prevImplicitNoneType_) {
               Say("IMPLICIT statement after IMPLICIT NONE or "
                   "IMPLICIT NONE(TYPE) statement"_err_en_US);
@@ -1720,7 +1720,7 @@ void ImplicitRulesVisitor::BeginScope(const Scope &scope) {
 
 // TODO: for all of these errors, reference previous statement too
 bool ImplicitRulesVisitor::HandleImplicitNone(
-    const std::list<ImplicitNoneNameSpec> &nameSpecs) {
+    const parser::List<ImplicitNoneNameSpec> &nameSpecs) {
   if (prevImplicitNone_) {
     Say("More than one IMPLICIT NONE statement"_err_en_US);
     Say(*prevImplicitNone_, "Previous IMPLICIT NONE statement"_en_US);
@@ -2166,7 +2166,7 @@ bool ModuleVisitor::Pre(const parser::UseStmt &x) {
   return useModuleScope_ != nullptr;
 }
 void ModuleVisitor::Post(const parser::UseStmt &x) {
-  if (const auto *list{std::get_if<std::list<parser::Rename>>(&x.u)}) {
+  if (const auto *list{std::get_if<parser::List<parser::Rename>>(&x.u)}) {
     // Not a use-only: collect the names that were used in renames,
     // then add a use for each public name that was not renamed.
     std::set<SourceName> useNames;
@@ -2398,7 +2398,7 @@ bool InterfaceVisitor::Pre(const parser::ProcedureStmt &x) {
     return false;
   }
   auto kind{std::get<parser::ProcedureStmt::Kind>(x.t)};
-  const auto &names{std::get<std::list<parser::Name>>(x.t)};
+  const auto &names{std::get<parser::List<parser::Name>>(x.t)};
   AddSpecificProcs(names, kind);
   return false;
 }
@@ -2411,7 +2411,7 @@ void InterfaceVisitor::Post(const parser::GenericStmt &x) {
   if (auto &accessSpec{std::get<std::optional<parser::AccessSpec>>(x.t)}) {
     GetGenericInfo().symbol->attrs().set(AccessSpecToAttr(*accessSpec));
   }
-  const auto &names{std::get<std::list<parser::Name>>(x.t)};
+  const auto &names{std::get<parser::List<parser::Name>>(x.t)};
   AddSpecificProcs(names, ProcedureKind::Procedure);
   genericInfo_.pop();
 }
@@ -2430,7 +2430,7 @@ GenericDetails &InterfaceVisitor::GetGenericDetails() {
 }
 
 void InterfaceVisitor::AddSpecificProcs(
-    const std::list<parser::Name> &names, ProcedureKind kind) {
+    const parser::List<parser::Name> &names, ProcedureKind kind) {
   for (const auto &name : names) {
     specificProcs_.emplace(
         GetGenericInfo().symbol, std::make_pair(&name, kind));
@@ -2636,7 +2636,7 @@ bool SubprogramVisitor::HandleStmtFunction(const parser::StmtFunctionStmt &x) {
   }
   auto &symbol{PushSubprogramScope(name, Symbol::Flag::Function)};
   auto &details{symbol.get<SubprogramDetails>()};
-  for (const auto &dummyName : std::get<std::list<parser::Name>>(x.t)) {
+  for (const auto &dummyName : std::get<parser::List<parser::Name>>(x.t)) {
     EntityDetails dummyDetails{true};
     if (auto *dummySymbol{FindInScope(currScope().parent(), dummyName)}) {
       if (auto *d{dummySymbol->detailsIf<EntityDetails>()}) {
@@ -2712,7 +2712,8 @@ bool SubprogramVisitor::Pre(const parser::FunctionStmt &) {
 void SubprogramVisitor::Post(const parser::SubroutineStmt &stmt) {
   const auto &name{std::get<parser::Name>(stmt.t)};
   auto &details{PostSubprogramStmt(name)};
-  for (const auto &dummyArg : std::get<std::list<parser::DummyArg>>(stmt.t)) {
+  for (const auto &dummyArg :
+      std::get<parser::List<parser::DummyArg>>(stmt.t)) {
     if (const auto *dummyName{std::get_if<parser::Name>(&dummyArg.u)}) {
       Symbol &dummy{MakeSymbol(*dummyName, EntityDetails(true))};
       details.add_dummyArg(dummy);
@@ -2725,7 +2726,7 @@ void SubprogramVisitor::Post(const parser::SubroutineStmt &stmt) {
 void SubprogramVisitor::Post(const parser::FunctionStmt &stmt) {
   const auto &name{std::get<parser::Name>(stmt.t)};
   auto &details{PostSubprogramStmt(name)};
-  for (const auto &dummyName : std::get<std::list<parser::Name>>(stmt.t)) {
+  for (const auto &dummyName : std::get<parser::List<parser::Name>>(stmt.t)) {
     Symbol &dummy{MakeSymbol(dummyName, EntityDetails(true))};
     details.add_dummyArg(dummy);
   }
@@ -3083,7 +3084,7 @@ bool DeclarationVisitor::Pre(const parser::ExternalStmt &x) {
 }
 bool DeclarationVisitor::Pre(const parser::IntentStmt &x) {
   auto &intentSpec{std::get<parser::IntentSpec>(x.t)};
-  auto &names{std::get<std::list<parser::Name>>(x.t)};
+  auto &names{std::get<parser::List<parser::Name>>(x.t)};
   return CheckNotInBlock("INTENT") &&  // C1107
       HandleAttributeStmt(IntentSpecToAttr(intentSpec), names);
 }
@@ -3118,7 +3119,7 @@ bool DeclarationVisitor::Pre(const parser::VolatileStmt &x) {
 }
 // Handle a statement that sets an attribute on a list of names.
 bool DeclarationVisitor::HandleAttributeStmt(
-    Attr attr, const std::list<parser::Name> &names) {
+    Attr attr, const parser::List<parser::Name> &names) {
   for (const auto &name : names) {
     HandleAttributeStmt(attr, name);
   }
@@ -3435,7 +3436,7 @@ void DeclarationVisitor::Post(const parser::DerivedTypeSpec &x) {
   auto nextNameIter{parameterNames.begin()};
   bool seenAnyName{false};
   for (const auto &typeParamSpec :
-      std::get<std::list<parser::TypeParamSpec>>(x.t)) {
+      std::get<parser::List<parser::TypeParamSpec>>(x.t)) {
     const auto &optKeyword{
         std::get<std::optional<parser::Keyword>>(typeParamSpec.t)};
     SourceName name;
@@ -3534,13 +3535,15 @@ void DeclarationVisitor::Post(const parser::DerivedTypeSpec &x) {
 bool DeclarationVisitor::Pre(const parser::DerivedTypeDef &x) {
   auto &stmt{std::get<parser::Statement<parser::DerivedTypeStmt>>(x.t)};
   Walk(stmt);
-  Walk(std::get<std::list<parser::Statement<parser::TypeParamDefStmt>>>(x.t));
+  Walk(
+      std::get<parser::List<parser::Statement<parser::TypeParamDefStmt>>>(x.t));
   auto &scope{currScope()};
   CHECK(scope.symbol());
   CHECK(scope.symbol()->scope() == &scope);
   auto &details{scope.symbol()->get<DerivedTypeDetails>()};
   std::set<SourceName> paramNames;
-  for (auto &paramName : std::get<std::list<parser::Name>>(stmt.statement.t)) {
+  for (auto &paramName :
+      std::get<parser::List<parser::Name>>(stmt.statement.t)) {
     details.add_paramName(paramName.source);
     auto *symbol{FindInScope(scope, paramName)};
     if (!symbol) {
@@ -3562,7 +3565,8 @@ bool DeclarationVisitor::Pre(const parser::DerivedTypeDef &x) {
           currScope());  // C742
     }
   }
-  Walk(std::get<std::list<parser::Statement<parser::PrivateOrSequence>>>(x.t));
+  Walk(std::get<parser::List<parser::Statement<parser::PrivateOrSequence>>>(
+      x.t));
   if (derivedTypeInfo_.sequence) {
     details.set_sequence(true);
     if (derivedTypeInfo_.extends) {
@@ -3574,7 +3578,8 @@ bool DeclarationVisitor::Pre(const parser::DerivedTypeDef &x) {
           "A sequence type may not have type parameters"_err_en_US);  // C740
     }
   }
-  Walk(std::get<std::list<parser::Statement<parser::ComponentDefStmt>>>(x.t));
+  Walk(
+      std::get<parser::List<parser::Statement<parser::ComponentDefStmt>>>(x.t));
   Walk(std::get<std::optional<parser::TypeBoundProcedurePart>>(x.t));
   Walk(std::get<parser::Statement<parser::EndTypeStmt>>(x.t));
   derivedTypeInfo_ = {};
@@ -3622,7 +3627,7 @@ void DeclarationVisitor::Post(const parser::DerivedTypeStmt &x) {
 void DeclarationVisitor::Post(const parser::TypeParamDefStmt &x) {
   auto *type{GetDeclTypeSpec()};
   auto attr{std::get<common::TypeParamAttr>(x.t)};
-  for (auto &decl : std::get<std::list<parser::TypeParamDecl>>(x.t)) {
+  for (auto &decl : std::get<parser::List<parser::TypeParamDecl>>(x.t)) {
     auto &name{std::get<parser::Name>(decl.t)};
     if (Symbol * symbol{MakeTypeSymbol(name, TypeParamDetails{attr})}) {
       SetType(name, *type);
@@ -3862,7 +3867,7 @@ void DeclarationVisitor::Post(const parser::FinalProcedureStmt &x) {
 bool DeclarationVisitor::Pre(const parser::TypeBoundGenericStmt &x) {
   const auto &accessSpec{std::get<std::optional<parser::AccessSpec>>(x.t)};
   const auto &genericSpec{std::get<Indirection<parser::GenericSpec>>(x.t)};
-  const auto &bindingNames{std::get<std::list<parser::Name>>(x.t)};
+  const auto &bindingNames{std::get<parser::List<parser::Name>>(x.t)};
   auto info{GenericSpecInfo{genericSpec.value()}};
   SourceName symbolName{info.symbolName()};
   bool isPrivate{accessSpec ? accessSpec->v == parser::AccessSpec::Kind::Private
@@ -3929,7 +3934,7 @@ bool DeclarationVisitor::Pre(const parser::StructureConstructor &x) {
   // can apply to structure constructors that have been converted
   // from misparsed function references.
   for (const auto &component :
-      std::get<std::list<parser::ComponentSpec>>(x.t)) {
+      std::get<parser::List<parser::ComponentSpec>>(x.t)) {
     // Visit the component spec expression, but not the keyword, since
     // we need to resolve its symbol in the scope of the derived type.
     Walk(std::get<parser::ComponentDataSource>(component.t));
@@ -4024,7 +4029,7 @@ bool DeclarationVisitor::Pre(const parser::NamelistStmt::Group &x) {
   }
 
   NamelistDetails details;
-  for (const auto &name : std::get<std::list<parser::Name>>(x.t)) {
+  for (const auto &name : std::get<parser::List<parser::Name>>(x.t)) {
     auto *symbol{FindSymbol(name)};
     if (!symbol) {
       symbol = &MakeSymbol(name, ObjectEntityDetails{});
@@ -4105,7 +4110,7 @@ void DeclarationVisitor::Post(const parser::CommonBlockObject &x) {
 bool DeclarationVisitor::Pre(const parser::EquivalenceStmt &x) {
   // save equivalence sets to be processed after specification part
   CheckNotInBlock("EQUIVALENCE");  // C1107
-  for (const std::list<parser::EquivalenceObject> &set : x.v) {
+  for (const parser::List<parser::EquivalenceObject> &set : x.v) {
     equivalenceSets_.push_back(&set);
   }
   return false;  // don't implicitly declare names yet
@@ -4704,7 +4709,7 @@ bool ConstructVisitor::Pre(const parser::ConcurrentHeader &header) {
 
   // Process the index-name nodes in the ConcurrentControl nodes
   const auto &controls{
-      std::get<std::list<parser::ConcurrentControl>>(header.t)};
+      std::get<parser::List<parser::ConcurrentControl>>(header.t)};
   for (const auto &control : controls) {
     ResolveIndexName(control);
   }
@@ -4763,7 +4768,7 @@ bool ConstructVisitor::Pre(const parser::AcSpec &x) {
 }
 
 bool ConstructVisitor::Pre(const parser::AcImpliedDo &x) {
-  auto &values{std::get<std::list<parser::AcValue>>(x.t)};
+  auto &values{std::get<parser::List<parser::AcValue>>(x.t)};
   auto &control{std::get<parser::AcImpliedDoControl>(x.t)};
   auto &type{std::get<std::optional<parser::IntegerTypeSpec>>(control.t)};
   auto &bounds{std::get<parser::AcImpliedDoControl::Bounds>(control.t)};
@@ -4774,7 +4779,7 @@ bool ConstructVisitor::Pre(const parser::AcImpliedDo &x) {
 }
 
 bool ConstructVisitor::Pre(const parser::DataImpliedDo &x) {
-  auto &objects{std::get<std::list<parser::DataIDoObject>>(x.t)};
+  auto &objects{std::get<parser::List<parser::DataIDoObject>>(x.t)};
   auto &type{std::get<std::optional<parser::IntegerTypeSpec>>(x.t)};
   auto &bounds{std::get<parser::DataImpliedDo::Bounds>(x.t)};
   DeclareStatementEntity(bounds.name.thing.thing, type);
@@ -5405,7 +5410,7 @@ void DeclarationVisitor::Initialization(const parser::Name &name,
                 details->set_init(std::move(*expr));
               }
             },
-            [&](const std::list<Indirection<parser::DataStmtValue>> &) {
+            [&](const parser::List<Indirection<parser::DataStmtValue>> &) {
               if (inComponentDecl) {
                 Say(name,
                     "Component '%s' initialized with DATA statement values"_err_en_US);
@@ -5481,7 +5486,7 @@ void ResolveNamesVisitor::HandleCall(
           [&](const parser::ProcComponentRef &x) { Walk(x); },
       },
       std::get<parser::ProcedureDesignator>(call.t).u);
-  Walk(std::get<std::list<parser::ActualArgSpec>>(call.t));
+  Walk(std::get<parser::List<parser::ActualArgSpec>>(call.t));
 }
 
 void ResolveNamesVisitor::HandleProcedureName(
@@ -5601,7 +5606,7 @@ bool ModuleVisitor::Pre(const parser::AccessStmt &x) {
         EnumToString(accessAttr));
     return false;
   }
-  const auto &accessIds{std::get<std::list<parser::AccessId>>(x.t)};
+  const auto &accessIds{std::get<parser::List<parser::AccessId>>(x.t)};
   if (accessIds.empty()) {
     if (prevAccessStmt_) {
       Say("The default accessibility of this module has already been declared"_err_en_US)
@@ -5673,7 +5678,7 @@ bool ResolveNamesVisitor::Pre(const parser::SpecificationPart &x) {
   Walk(std::get<1>(x.t));
   Walk(std::get<2>(x.t));
   Walk(std::get<3>(x.t));
-  const std::list<parser::DeclarationConstruct> &decls{std::get<4>(x.t)};
+  const parser::List<parser::DeclarationConstruct> &decls{std::get<4>(x.t)};
   for (const auto &decl : decls) {
     if (const auto *spec{
             std::get_if<parser::SpecificationConstruct>(&decl.u)}) {
@@ -5850,7 +5855,7 @@ bool ResolveNamesVisitor::Pre(const parser::StmtFunctionStmt &x) {
   CheckNotInBlock("STATEMENT FUNCTION");  // C1107
   if (!HandleStmtFunction(x)) {
     // This is an array element assignment: resolve names of indices
-    const auto &names{std::get<std::list<parser::Name>>(x.t)};
+    const auto &names{std::get<parser::List<parser::Name>>(x.t)};
     for (auto &name : names) {
       ResolveName(name);
     }
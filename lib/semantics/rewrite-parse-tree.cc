@@ -83,7 +83,7 @@ void RewriteMutator::Post(parser::Name &name) {
 
 // Find mis-parsed statement functions and move to stmtFuncsToConvert_ list.
 void RewriteMutator::Post(parser::SpecificationPart &x) {
-  auto &list{std::get<std::list<parser::DeclarationConstruct>>(x.t)};
+  auto &list{std::get<parser::List<parser::DeclarationConstruct>>(x.t)};
   for (auto it{list.begin()}; it != list.end();) {
     if (auto stmt{std::get_if<stmtFuncType>(&it->u)}) {
       Symbol *symbol{std::get<parser::Name>(stmt->statement.value().t).symbol};
@@ -100,14 +100,13 @@ void RewriteMutator::Post(parser::SpecificationPart &x) {
 
 // Insert converted assignments at start of ExecutionPart.
 bool RewriteMutator::Pre(parser::ExecutionPart &x) {
-  auto origFirst{x.v.begin()};  // insert each elem before origFirst
+  parser::Block converted;
   for (stmtFuncType &sf : stmtFuncsToConvert_) {
     auto stmt{sf.statement.value().ConvertToAssignment()};
     stmt.source = sf.source;
-    x.v.insert(origFirst,
-        parser::ExecutionPartConstruct{
-            parser::ExecutableConstruct{std::move(stmt)}});
+    converted.emplace_back(parser::ExecutableConstruct{std::move(stmt)});
   }
+  x.v.splice(x.v.begin(), converted);
   stmtFuncsToConvert_.clear();
   return true;
 }
@@ -62,6 +62,19 @@ Scope &Scope::MakeScope(Kind kind, Symbol *symbol) {
   return children_.emplace_back(*this, kind, symbol);
 }
 
+static void MoveScope(
+    const Scope &scope, std::list<Scope> &from, std::list<Scope> &to) {
+  auto iter{std::find(from.begin(), from.end(), scope)};
+  CHECK(iter != from.end());
+  to.splice(to.end(), from, iter);
+}
+void Scope::SetAsideChild(const Scope &child, std::list<Scope> &to) {
+  MoveScope(child, children_, to);
+}
+void Scope::RestoreChild(const Scope &child, std::list<Scope> &from) {
+  MoveScope(child, from, children_);
+}
+
 Scope::iterator Scope::find(const SourceName &name) {
   return symbols_.find(name);
 }
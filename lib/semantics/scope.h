@@ -100,6 +100,10 @@ public:
 
   /// Make a scope nested in this one
   Scope &MakeScope(Kind kind, Symbol *symbol = nullptr);
+  // Move a nested scope to another list and back without changing its
+  // address, e.g. to hide it from traversals of the scope tree
+  void SetAsideChild(const Scope &, std::list<Scope> &);
+  void RestoreChild(const Scope &, std::list<Scope> &);
 
   using size_type = mapType::size_type;
   using iterator = mapType::iterator;
@@ -117,6 +121,10 @@ public:
     return symbols_.find(name);
   }
   size_type erase(const SourceName &);
+  // Add an existing symbol, e.g. one that was previously erased
+  bool insert(const SourceName &name, Symbol &symbol) {
+    return symbols_.emplace(name, symbol).second;
+  }
   size_type size() const { return symbols_.size(); }
   bool empty() const { return symbols_.empty(); }
 
@@ -37,6 +37,7 @@
 #include "scope.h"
 #include "symbol.h"
 #include "../common/default-kinds.h"
+#include "../common/time-report.h"
 #include "../parser/parse-tree-visitor.h"
 
 namespace Fortran::semantics {
@@ -122,11 +123,18 @@ using StatementSemanticsPass2 = SemanticsVisitor<AllocateChecker,
 
 static bool PerformStatementSemantics(
     SemanticsContext &context, parser::Program &program) {
-  ResolveNames(context, program);
-  RewriteParseTree(context, program);
-  CheckDeclarations(context);
-  StatementSemanticsPass1{context}.Walk(program);
-  return StatementSemanticsPass2{context}.Walk(program);
+  using common::TimeReport;
+  TimeReport *report{context.timeReport()};
+  TimeReport::Measure(
+      report, "ResolveNames", [&]() { ResolveNames(context, program); });
+  TimeReport::Measure(report, "RewriteParseTree",
+      [&]() { RewriteParseTree(context, program); });
+  TimeReport::Measure(
+      report, "CheckDeclarations", [&]() { CheckDeclarations(context); });
+  TimeReport::Measure(report, "StatementSemantics1",
+      [&]() { StatementSemanticsPass1{context}.Walk(program); });
+  return TimeReport::Measure(report, "StatementSemantics2",
+      [&]() { return StatementSemanticsPass2{context}.Walk(program); });
 }
 
 SemanticsContext::SemanticsContext(
@@ -167,6 +175,62 @@ const DeclTypeSpec &SemanticsContext::MakeLogicalType(int kind) {
   return globalScope_.MakeLogicalType(KindExpr{kind});
 }
 
+void SemanticsContext::SetAsideModFileModules() {
+  std::vector<SourceName> names;
+  for (const auto &pair : globalScope_) {
+    Symbol &symbol{*pair.second};
+    if (symbol.test(Symbol::Flag::ModFile)) {
+      names.push_back(pair.first);
+      setAsideModules_.emplace(symbol.name(), &symbol);
+      globalScope_.SetAsideChild(DEREF(symbol.scope()), setAsideScopes_);
+    }
+  }
+  for (const auto &name : names) {
+    globalScope_.erase(name);
+  }
+}
+
+Symbol *SemanticsContext::RestoreModFileModule(const SourceName &name) {
+  auto iter{setAsideModules_.find(name)};
+  if (iter == setAsideModules_.end()) {
+    return nullptr;
+  }
+  Symbol *symbol{iter->second};
+  setAsideModules_.erase(iter);
+  globalScope_.insert(symbol->name(), *symbol);
+  globalScope_.RestoreChild(DEREF(symbol->scope()), setAsideScopes_);
+  return symbol;
+}
+
+void SemanticsContext::ResetForNextCompilation() {
+  messages_.clear();
+  location_.reset();
+  constructStack_.clear();
+  std::vector<SourceName> names;
+  for (const auto &pair : globalScope_) {
+    if (!pair.second->test(Symbol::Flag::ModFile)) {
+      names.push_back(pair.first);
+    }
+  }
+  for (const auto &name : names) {
+    globalScope_.erase(name);
+    // a module that was compiled has a new module file to be read
+    setAsideModules_.erase(name);
+  }
+  // Symbols from module files may still refer to the discarded scopes,
+  // so they are kept out of sight rather than destroyed.
+  std::vector<const Scope *> discarded;
+  for (const Scope &child : globalScope_.children()) {
+    if (!child.IsModuleFile()) {
+      discarded.push_back(&child);
+    }
+  }
+  for (const Scope *child : discarded) {
+    globalScope_.SetAsideChild(*child, setAsideScopes_);
+  }
+  SetAsideModFileModules();
+}
+
 bool SemanticsContext::AnyFatalError() const {
   return !messages_.empty() &&
       (warningsAreErrors_ || messages_.AnyFatalError());
@@ -209,11 +273,17 @@ void SemanticsContext::PopConstruct() {
 }
 
 bool Semantics::Perform() {
-  return ValidateLabels(context_, program_) &&
-      parser::CanonicalizeDo(program_) &&  // force line break
-      CanonicalizeOmp(context_.messages(), program_) &&
+  using common::TimeReport;
+  TimeReport *report{context_.timeReport()};
+  return TimeReport::Measure(report, "ValidateLabels",
+             [&]() { return ValidateLabels(context_, program_); }) &&
+      TimeReport::Measure(report, "CanonicalizeDo",
+          [&]() { return parser::CanonicalizeDo(program_); }) &&
+      TimeReport::Measure(report, "CanonicalizeOmp",
+          [&]() { return CanonicalizeOmp(context_.messages(), program_); }) &&
       PerformStatementSemantics(context_, program_) &&
-      ModFileWriter{context_}.WriteAll();
+      TimeReport::Measure(report, "WriteModFiles",
+          [&]() { return ModFileWriter{context_}.WriteAll(); });
 }
 
 void Semantics::EmitMessages(std::ostream &os) const {
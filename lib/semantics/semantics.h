@@ -21,11 +21,13 @@
 #include "../evaluate/intrinsics.h"
 #include "../parser/message.h"
 #include <iosfwd>
+#include <list>
 #include <string>
 #include <vector>
 
 namespace Fortran::common {
 class IntrinsicTypeDefaultKinds;
+class TimeReport;
 }
 
 namespace Fortran::parser {
@@ -82,6 +84,8 @@ public:
   }
   const std::string &moduleDirectory() const { return moduleDirectory_; }
   const std::string &moduleFileSuffix() const { return moduleFileSuffix_; }
+  const std::string &parseTreeDirectory() const { return parseTreeDirectory_; }
+  bool writeInterfaceHashes() const { return writeInterfaceHashes_; }
   bool warnOnNonstandardUsage() const { return warnOnNonstandardUsage_; }
   bool warningsAreErrors() const { return warningsAreErrors_; }
   const evaluate::IntrinsicProcTable &intrinsics() const { return intrinsics_; }
@@ -89,6 +93,7 @@ public:
   parser::Messages &messages() { return messages_; }
   evaluate::FoldingContext &foldingContext() { return foldingContext_; }
   parser::AllSources &allSources() { return allSources_; }
+  common::TimeReport *timeReport() const { return timeReport_; }
 
   SemanticsContext &set_location(
       const std::optional<parser::CharBlock> &location) {
@@ -107,6 +112,14 @@ public:
     moduleFileSuffix_ = x;
     return *this;
   }
+  SemanticsContext &set_parseTreeDirectory(const std::string &x) {
+    parseTreeDirectory_ = x;
+    return *this;
+  }
+  SemanticsContext &set_writeInterfaceHashes(bool x) {
+    writeInterfaceHashes_ = x;
+    return *this;
+  }
   SemanticsContext &set_warnOnNonstandardUsage(bool x) {
     warnOnNonstandardUsage_ = x;
     return *this;
@@ -115,6 +128,10 @@ public:
     warningsAreErrors_ = x;
     return *this;
   }
+  SemanticsContext &set_timeReport(common::TimeReport *x) {
+    timeReport_ = x;
+    return *this;
+  }
 
   const DeclTypeSpec &MakeNumericType(TypeCategory, int kind = 0);
   const DeclTypeSpec &MakeLogicalType(int kind = 0);
@@ -142,6 +159,15 @@ public:
   const Scope &FindScope(parser::CharBlock) const;
   Scope &FindScope(parser::CharBlock);
 
+  // Modules already read from module files can be set aside so that a
+  // subsequent compilation in this context sees one only when it is used.
+  void SetAsideModFileModules();
+  Symbol *RestoreModFileModule(const SourceName &);
+  // Discard the program units and messages of a compilation so that this
+  // context can be reused for another source file, retaining the
+  // intrinsic procedure table and set-aside modules.
+  void ResetForNextCompilation();
+
   const ConstructStack &constructStack() const { return constructStack_; }
   template<typename N> void PushConstruct(const N &node) {
     constructStack_.emplace_back(&node);
@@ -156,8 +182,11 @@ private:
   std::vector<std::string> searchDirectories_;
   std::string moduleDirectory_{"."s};
   std::string moduleFileSuffix_{".mod"};
+  std::string parseTreeDirectory_;  // empty: parse trees are not saved
+  bool writeInterfaceHashes_{false};
   bool warnOnNonstandardUsage_{false};
   bool warningsAreErrors_{false};
+  common::TimeReport *timeReport_{nullptr};
   const evaluate::IntrinsicProcTable intrinsics_;
   Scope globalScope_;
   parser::Messages messages_;
@@ -165,6 +194,8 @@ private:
 
   bool CheckError(bool);
   ConstructStack constructStack_;
+  std::map<SourceName, Symbol *> setAsideModules_;
+  std::list<Scope> setAsideScopes_;
 };
 
 class Semantics {
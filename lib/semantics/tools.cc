@@ -649,7 +649,8 @@ public:
     return (*this)(x.value());
   }
   bool operator()(const parser::AllocateStmt &stmt) {
-    const auto &allocationList{std::get<std::list<parser::Allocation>>(stmt.t)};
+    const auto &allocationList{
+        std::get<parser::List<parser::Allocation>>(stmt.t)};
     for (const auto &allocation : allocationList) {
       const auto &allocateObject{
           std::get<parser::AllocateObject>(allocation.t)};
@@ -661,7 +662,7 @@ public:
   }
   bool operator()(const parser::DeallocateStmt &stmt) {
     const auto &allocateObjectList{
-        std::get<std::list<parser::AllocateObject>>(stmt.t)};
+        std::get<parser::List<parser::AllocateObject>>(stmt.t)};
     for (const auto &allocateObject : allocateObjectList) {
       if (IsCoarrayObject(allocateObject)) {
         return true;
@@ -675,7 +676,8 @@ public:
     if (auto *name{std::get_if<parser::Name>(&procedureDesignator.u)}) {
       // TODO: also ensure that the procedure is, in fact, an intrinsic
       if (name->source == "move_alloc") {
-        const auto &args{std::get<std::list<parser::ActualArgSpec>>(stmt.v.t)};
+        const auto &args{
+            std::get<parser::List<parser::ActualArgSpec>>(stmt.v.t)};
         if (!args.empty()) {
           const parser::ActualArg &actualArg{
               std::get<parser::ActualArg>(args.front().t)};
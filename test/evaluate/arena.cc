@@ -0,0 +1,97 @@
+// Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../lib/common/arena.h"
+#include "../../lib/common/indirection.h"
+#include "../../lib/parser/list.h"
+#include "testing.h"
+#include <cstdint>
+#include <list>
+#include <string>
+
+using Fortran::common::Arena;
+using Fortran::common::ArenaAllocator;
+using Fortran::common::Indirection;
+
+template<typename A> using List = std::list<A, ArenaAllocator<A>>;
+
+int main() {
+  Arena arena;
+  List<std::string> heapList;
+  heapList.emplace_back("heap");
+  MATCH(0, arena.bytes());
+  {
+    Arena::Scope scope{&arena};
+    Indirection<std::string> x{std::string(100, 'x')};
+    TEST(arena.bytes() > 0);
+    MATCH(100, x.value().size());
+    List<std::string> arenaList;
+    for (int j{0}; j < 10000; ++j) {
+      arenaList.emplace_back(std::to_string(j));
+    }
+    TEST(reinterpret_cast<std::uintptr_t>(&arenaList.back()) %
+            alignof(std::max_align_t) ==
+        0);
+    heapList.splice(heapList.end(), arenaList);
+    MATCH(0, arenaList.size());
+    {
+      Arena::Scope noScope{nullptr};
+      std::size_t before{arena.bytes()};
+      Indirection<std::string> y{std::string{"heap"}};
+      MATCH(before, arena.bytes());
+    }
+  }
+  MATCH(10001, heapList.size());
+  MATCH("heap", heapList.front());
+  MATCH("9999", heapList.back());
+  heapList.pop_front();  // frees a heap block
+  heapList.pop_back();  // does nothing to the arena
+  MATCH(9999, heapList.size());
+  Arena other;
+  {
+    Arena::Scope scope{&other};
+    heapList.emplace_back(std::string(Arena::pageBytes, 'y'));
+  }
+  std::size_t bytes{arena.bytes() + other.bytes()};
+  arena.Adopt(std::move(other));
+  MATCH(bytes, arena.bytes());
+  MATCH(0, other.bytes());
+  MATCH(Arena::pageBytes, heapList.back().size());
+  heapList.clear();
+
+  // parser::List<> elements keep their addresses
+  Fortran::parser::List<std::string> x, y;
+  {
+    Arena::Scope scope{&arena};
+    for (int j{0}; j < 10; ++j) {
+      x.emplace_back(std::to_string(j));
+    }
+  }
+  const std::string *five{&*std::next(x.begin(), 5)};
+  x.erase(x.begin());
+  x.emplace_front("first");
+  y.splice(y.end(), x, std::next(x.begin(), 3), std::next(x.begin(), 7));
+  MATCH(6, x.size());
+  MATCH(4, y.size());
+  MATCH("3", y.front());
+  TEST(five == &*std::next(y.begin(), 2));
+  x.splice(x.begin(), x, std::prev(x.end()));
+  MATCH("9", x.front());
+  MATCH("8", x.back());
+  Fortran::parser::List<std::string> z{y};
+  TEST(z == y);
+  z.pop_back();
+  TEST(z != y);
+  return testing::Complete();
+}
@@ -0,0 +1,24 @@
+! Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+!
+! Licensed under the Apache License, Version 2.0 (the "License");
+! you may not use this file except in compliance with the License.
+! You may obtain a copy of the License at
+!
+!     http://www.apache.org/licenses/LICENSE-2.0
+!
+! Unless required by applicable law or agreed to in writing, software
+! distributed under the License is distributed on an "AS IS" BASIS,
+! WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+! See the License for the specific language governing permissions and
+! limitations under the License.
+
+! Tests -fbatch with a response file: batch01-b.f90 is compiled first in
+! the same process, and its subroutine s does not conflict with this one.
+
+subroutine s
+  use batch01m
+  x = 1.0
+end subroutine
+
+! RUN: mkdir %t && echo -module %t -I %t $(dirname %s)/batch01-b.f90 %s > %t/args && ${F18} -fbatch -fparse-only -fdebug-semantics @%t/args 2>&1 | ${FileCheck} %s && test -f %t/batch01m.mod
+! CHECK-NOT:error
@@ -0,0 +1,26 @@
+! Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+!
+! Licensed under the Apache License, Version 2.0 (the "License");
+! you may not use this file except in compliance with the License.
+! You may obtain a copy of the License at
+!
+!     http://www.apache.org/licenses/LICENSE-2.0
+!
+! Unless required by applicable law or agreed to in writing, software
+! distributed under the License is distributed on an "AS IS" BASIS,
+! WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+! See the License for the specific language governing permissions and
+! limitations under the License.
+
+! Tests -fcache-dir: the second compilation restores the module file
+! from the cache without parsing.
+
+module cache01
+  integer :: n
+end module
+
+! RUN: mkdir %t && ${F18} -fparse-only -fdebug-semantics -module %t -fcache-dir %t/cache %s && rm %t/cache01.mod && ${F18} -fparse-only -fdebug-semantics -module %t -fcache-dir %t/cache -ftime-report %s 2>&1 | ${FileCheck} %s && test -f %t/cache01.mod && test $(ls %t/cache | wc -l) -eq 1
+! CHECK:^Prescan
+! CHECK:^Cache
+! CHECK-NOT:^Parse
+! CHECK-NOT:^ResolveNames
@@ -0,0 +1,28 @@
+! Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+!
+! Licensed under the Apache License, Version 2.0 (the "License");
+! you may not use this file except in compliance with the License.
+! You may obtain a copy of the License at
+!
+!     http://www.apache.org/licenses/LICENSE-2.0
+!
+! Unless required by applicable law or agreed to in writing, software
+! distributed under the License is distributed on an "AS IS" BASIS,
+! WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+! See the License for the specific language governing permissions and
+! limitations under the License.
+
+! Tests -fdeps-scan in its Makefile and ninja dyndep formats.
+
+module depscan01m
+  use, intrinsic :: iso_c_binding
+  use depscan01x, only: x
+  include "depscan01.h"
+end module
+
+! RUN: (${F18} -fdeps-scan -module %t %s;
+! RUN:  ${F18} -fdeps-scan -fdeps-format=ninja -module %t %s) 2>&1 | ${FileCheck} %s
+! CHECK:^depscan01\.o .*/depscan01m\.mod: .*/depscan01\.f90 .*/depscan01\.h .*/depscan01x\.mod$
+! CHECK:^ninja_dyndep_version = 1$
+! CHECK:^build depscan01\.o \| .*/depscan01m\.mod: dyndep \| .*/depscan01\.h .*/depscan01x\.mod$
+! CHECK-NOT:iso_c_binding
@@ -0,0 +1,32 @@
+! Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+!
+! Licensed under the Apache License, Version 2.0 (the "License");
+! you may not use this file except in compliance with the License.
+! You may obtain a copy of the License at
+!
+!     http://www.apache.org/licenses/LICENSE-2.0
+!
+! Unless required by applicable law or agreed to in writing, software
+! distributed under the License is distributed on an "AS IS" BASIS,
+! WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+! See the License for the specific language governing permissions and
+! limitations under the License.
+
+! Tests -fmodule-interface-hash: a change to a private entity leaves the
+! interface hash unchanged, but a change to a public one does not.
+
+module interfacehash01
+#ifdef PUBLIC
+  real :: n
+#else
+  integer :: n
+#endif
+  private :: secret
+#ifdef PRIVATE
+  real :: secret
+#else
+  integer :: secret
+#endif
+end module
+
+! RUN: mkdir %t && ${F18} -fparse-only -fdebug-semantics -fmodule-interface-hash -module %t %s && cp %t/interfacehash01.mod.ihash %t/before && ${F18} -fparse-only -fdebug-semantics -fmodule-interface-hash -module %t -DPRIVATE %s && cmp %t/before %t/interfacehash01.mod.ihash && ${F18} -fparse-only -fdebug-semantics -fmodule-interface-hash -module %t -DPUBLIC %s && ! cmp -s %t/before %t/interfacehash01.mod.ihash
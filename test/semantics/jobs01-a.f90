@@ -0,0 +1,24 @@
+! Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+!
+! Licensed under the Apache License, Version 2.0 (the "License");
+! you may not use this file except in compliance with the License.
+! You may obtain a copy of the License at
+!
+!     http://www.apache.org/licenses/LICENSE-2.0
+!
+! Unless required by applicable law or agreed to in writing, software
+! distributed under the License is distributed on an "AS IS" BASIS,
+! WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+! See the License for the specific language governing permissions and
+! limitations under the License.
+
+! Tests -j: jobs01-b.f90 must be compiled before this file, which uses
+! the modules that it defines, even though it appears later.
+
+program main
+  use jobs01m2
+  call s(x)
+end program
+
+! RUN: mkdir %t && ${F18} -j 2 -fparse-only -fdebug-semantics -module %t -I %t %s $(dirname %s)/jobs01-b.f90 2>&1 | ${FileCheck} %s && test -f %t/jobs01m1.mod && test -f %t/jobs01m2.mod
+! CHECK-NOT:error
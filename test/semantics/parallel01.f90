@@ -0,0 +1,59 @@
+! Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+!
+! Licensed under the Apache License, Version 2.0 (the "License");
+! you may not use this file except in compliance with the License.
+! You may obtain a copy of the License at
+!
+!     http://www.apache.org/licenses/LICENSE-2.0
+!
+! Unless required by applicable law or agreed to in writing, software
+! distributed under the License is distributed on an "AS IS" BASIS,
+! WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+! See the License for the specific language governing permissions and
+! limitations under the License.
+
+! Tests -fparse-threads: the parse tree must be the same as that of
+! a serial parse.
+
+module parallel01
+  interface gen
+    module procedure s1
+  end interface
+contains
+  subroutine s1(x)
+    real :: x
+    x = f(x)
+  contains
+    real function f(y)
+      real :: y
+      f = -y
+    end function
+  end subroutine
+end module
+
+integer(kind=4) pure function f2(n)
+  integer, intent(in) :: n
+  f2 = n + 1
+end
+
+subroutine s2(a, n)
+  interface
+    subroutine ext(x)
+      real :: x
+    end subroutine
+  end interface
+  real :: a(n)
+  do j = 1, n
+    call ext(a(j))
+  end do
+end subroutine s2
+
+program main
+  use parallel01
+  real :: z
+  z = 1.0
+  call gen(z)
+  print *, z, ';'
+end program
+
+! RUN: mkdir %t && ${F18} -funparse %s > %t/serial.f90 && ${F18} -funparse -fparse-threads=4 %s > %t/parallel.f90 && cmp %t/serial.f90 %t/parallel.f90
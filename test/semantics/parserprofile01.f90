@@ -0,0 +1,31 @@
+! Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+!
+! Licensed under the Apache License, Version 2.0 (the "License");
+! you may not use this file except in compliance with the License.
+! You may obtain a copy of the License at
+!
+!     http://www.apache.org/licenses/LICENSE-2.0
+!
+! Unless required by applicable law or agreed to in writing, software
+! distributed under the License is distributed on an "AS IS" BASIS,
+! WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+! See the License for the specific language governing permissions and
+! limitations under the License.
+
+! Tests -fdebug-parser-profile.
+
+subroutine parserprofile01(a, n)
+  integer :: n
+  real :: a(n)
+  do j = 1, n
+    if (a(j) > 0) then
+      a(j) = -a(j)
+    end if
+  end do
+end subroutine
+
+! RUN: ${F18} -fparse-only -fdebug-parser-profile=100 %s 2>&1 | ${FileCheck} %s
+! CHECK:^parser profile: [0-9]+ productions$
+! CHECK:^ *msec +calls +pass +fail +consumed +backtrack +production$
+! CHECK:^ *[0-9.]+ +[0-9]+ +[0-9]+ +[0-9]+ +[0-9]+ +[0-9]+ +IF construct$
+! CHECK:^ *[0-9.]+ +[0-9]+ +[0-9]+ +[0-9]+ +[0-9]+ +[0-9]+ +assignment statement$
@@ -0,0 +1,32 @@
+! Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+!
+! Licensed under the Apache License, Version 2.0 (the "License");
+! you may not use this file except in compliance with the License.
+! You may obtain a copy of the License at
+!
+!     http://www.apache.org/licenses/LICENSE-2.0
+!
+! Unless required by applicable law or agreed to in writing, software
+! distributed under the License is distributed on an "AS IS" BASIS,
+! WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+! See the License for the specific language governing permissions and
+! limitations under the License.
+
+! Tests -fparse-tree-cache: the second compilation loads the parse tree
+! that the first one saved instead of prescanning and parsing the source.
+
+#define KIND 8
+module parsetree01
+  integer(kind=KIND) :: n(3) = [1, 2, 3]
+contains
+  subroutine s(x)
+    real, intent(inout) :: x
+    x = x + sum(n)
+  end subroutine
+end module
+
+! RUN: mkdir %t && ${F18} -funparse -fparse-tree-cache %t %s > %t/first.f90 && ${F18} -funparse -fparse-tree-cache %t -ftime-report %s 2>&1 > %t/second.f90 | ${FileCheck} %s && diff %t/first.f90 %t/second.f90 && test $(ls %t/*.tree | wc -l) -eq 1
+! CHECK-NOT:^Prescan
+! CHECK:^Load parse tree
+! CHECK-NOT:^Prescan
+! CHECK-NOT:^Parse
@@ -0,0 +1,35 @@
+! Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+!
+! Licensed under the Apache License, Version 2.0 (the "License");
+! you may not use this file except in compliance with the License.
+! You may obtain a copy of the License at
+!
+!     http://www.apache.org/licenses/LICENSE-2.0
+!
+! Unless required by applicable law or agreed to in writing, software
+! distributed under the License is distributed on an "AS IS" BASIS,
+! WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+! See the License for the specific language governing permissions and
+! limitations under the License.
+
+! Tests -ftime-report and -ftime-report-json.
+
+module timereport01
+  integer :: n
+end module
+
+! RUN: mkdir %t && ${F18} -fparse-only -fdebug-semantics -module %t -ftime-report-json %t/report.json %s 2>&1 | ${FileCheck} %s && grep -q '"name":"ResolveNames"' %t/report.json
+! CHECK:^Phase  *Wall \(s\)  *CPU \(s\)  *Peak RSS \(KiB\)  *Count$
+! CHECK:^Read source file  *[0-9.]+  *[0-9.]+  *[0-9]+  *1$
+! CHECK:^Prescan
+! CHECK:^Marshal
+! CHECK:^Parse
+! CHECK:^ValidateLabels
+! CHECK:^CanonicalizeDo
+! CHECK:^ResolveNames
+! CHECK:^RewriteParseTree
+! CHECK:^CheckDeclarations
+! CHECK:^StatementSemantics1
+! CHECK:^StatementSemantics2
+! CHECK:^WriteModFiles
+! CHECK:^Total
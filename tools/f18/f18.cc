@@ -16,30 +16,48 @@
 
 #include "../../lib/common/Fortran-features.h"
 #include "../../lib/common/default-kinds.h"
+#include "../../lib/common/fingerprint.h"
+#include "../../lib/common/time-report.h"
 #include "../../lib/evaluate/expression.h"
 #include "../../lib/parser/characters.h"
 #include "../../lib/parser/dump-parse-tree.h"
 #include "../../lib/parser/message.h"
+#include "../../lib/parser/module-dependencies.h"
 #include "../../lib/parser/parse-tree-visitor.h"
 #include "../../lib/parser/parse-tree.h"
 #include "../../lib/parser/parsing.h"
 #include "../../lib/parser/provenance.h"
+#include "../../lib/parser/source.h"
 #include "../../lib/parser/unparse.h"
 #include "../../lib/semantics/expression.h"
+#include "../../lib/semantics/mod-file.h"
 #include "../../lib/semantics/semantics.h"
+#include "../../lib/semantics/symbol.h"
 #include "../../lib/semantics/unparse-with-symbols.h"
+#include <algorithm>
 #include <cerrno>
+#include <chrono>
+#include <climits>
+#include <csignal>
 #include <cstdio>
 #include <cstring>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
 #include <optional>
+#include <set>
+#include <sstream>
 #include <stdlib.h>
 #include <string>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
 #include <sys/wait.h>
 #include <unistd.h>
+#include <utility>
 #include <vector>
 
 static std::list<std::string> argList(int argc, char *const argv[]) {
@@ -61,14 +79,45 @@ struct MeasurementVisitor {
 
 void MeasureParseTree(const Fortran::parser::Program &program) {
   MeasurementVisitor visitor;
+  auto start{std::chrono::steady_clock::now()};
   Fortran::parser::Walk(program, visitor);
+  std::chrono::duration<double, std::micro> elapsed{
+      std::chrono::steady_clock::now() - start};
   std::cout << "Parse tree comprises " << visitor.objects
-            << " objects and occupies " << visitor.bytes << " total bytes.\n";
+            << " objects and occupies " << visitor.bytes << " total bytes.\n"
+            << "Walking it took " << elapsed.count() << " microseconds.\n";
 }
 
 std::vector<std::string> filesToDelete;
 
+// -ftime-report totals for this process, printed at exit
+Fortran::common::TimeReport totalTimeReport;
+
+// A -j worker process buffers its standard output and error so that
+// messages from concurrent compilations are not interleaved.
+std::ostringstream workerCout, workerCerr;
+std::streambuf *savedCoutBuffer{nullptr}, *savedCerrBuffer{nullptr};
+
+void BufferWorkerOutput() {
+  savedCoutBuffer = std::cout.rdbuf(workerCout.rdbuf());
+  savedCerrBuffer = std::cerr.rdbuf(workerCerr.rdbuf());
+}
+
+void FlushWorkerOutput() {
+  if (savedCoutBuffer) {
+    std::cout.rdbuf(savedCoutBuffer);
+    std::cerr.rdbuf(savedCerrBuffer);
+    savedCoutBuffer = savedCerrBuffer = nullptr;
+    std::cout << workerCout.str() << std::flush;
+    std::cerr << workerCerr.str() << std::flush;
+  }
+}
+
 void CleanUpAtExit() {
+  if (!totalTimeReport.empty()) {
+    totalTimeReport.Dump(std::cerr);
+  }
+  FlushWorkerOutput();
   for (const auto &path : filesToDelete) {
     if (!path.empty()) {
       unlink(path.data());
@@ -101,6 +150,8 @@ struct DriverOptions {
   bool dumpSymbols{false};
   bool debugResolveNames{false};
   bool debugSemantics{false};
+  bool dumpParseMemoStatistics{false};  // -fdebug-parse-memo-stats
+  int parserProfileTop{0};  // -fdebug-parser-profile[=N]
   bool measureTree{false};
   bool unparseTypedExprsToPGF90{false};
   std::vector<std::string> pgf90Args;
@@ -108,20 +159,108 @@ struct DriverOptions {
   bool getDefinition{false};
   GetDefinitionArgs getDefinitionArgs{0, 0, 0};
   bool getSymbolsSources{false};
+  int jobs{1};  // -j N
+  bool pipeToBackend{false};  // -pipe
+  bool timeReport{false};  // -ftime-report
+  std::string timeReportJSON;  // -ftime-report-json file
+  bool scanDependencies{false};  // -fdeps-scan
+  bool ninjaDependencies{false};  // -fdeps-format=ninja
+  bool batch{false};  // -fbatch
+  std::string cacheDirectory;  // -fcache-dir dir
+  std::string parseTreeDirectory;  // -fparse-tree-cache dir
+  bool interfaceHashes{false};  // -fmodule-interface-hash
 };
 
-bool ParentProcess() {
-  if (fork() == 0) {
-    return false;  // in child process
+pid_t ForkChild() {
+  pid_t pid{fork()};
+  if (pid == 0) {
+    // in child process; don't repeat output buffered by a -j worker
+    // or the time report
+    workerCout.str("");
+    workerCerr.str("");
+    totalTimeReport = Fortran::common::TimeReport{};
   }
+  return pid;
+}
+
+void WaitForChild(pid_t pid) {
   int childStat{0};
-  wait(&childStat);
+  waitpid(pid, &childStat, 0);
   if (!WIFEXITED(childStat) || WEXITSTATUS(childStat) != 0) {
     exit(EXIT_FAILURE);
   }
+}
+
+bool ParentProcess() {
+  pid_t pid{ForkChild()};
+  if (pid == 0) {
+    return false;  // in child process
+  }
+  WaitForChild(pid);
   return true;
 }
 
+// An output stream buffer that writes to a file descriptor, e.g. a pipe
+class FileDescriptorBuffer : public std::streambuf {
+public:
+  explicit FileDescriptorBuffer(int fd) : fd_{fd} {
+    setp(buffer_, buffer_ + sizeof buffer_);
+  }
+  ~FileDescriptorBuffer() { sync(); }
+
+protected:
+  int overflow(int ch) override {
+    if (sync() != 0) {
+      return traits_type::eof();
+    }
+    if (ch != traits_type::eof()) {
+      *pptr() = ch;
+      pbump(1);
+    }
+    return traits_type::not_eof(ch);
+  }
+  int sync() override {
+    for (const char *p{pbase()}; p < pptr();) {
+      ssize_t wrote{write(fd_, p, pptr() - p)};
+      if (wrote <= 0) {
+        return -1;
+      }
+      p += wrote;
+    }
+    setp(buffer_, buffer_ + sizeof buffer_);
+    return 0;
+  }
+
+private:
+  int fd_;
+  char buffer_[1 << 16];
+};
+
+// An output stream buffer that passes what is written to another one
+// and also appends it to a string
+class TeeBuffer : public std::streambuf {
+public:
+  TeeBuffer(std::streambuf *to, std::string &copy) : to_{to}, copy_{copy} {}
+
+protected:
+  int overflow(int ch) override {
+    if (ch == traits_type::eof()) {
+      return traits_type::not_eof(ch);
+    }
+    copy_ += traits_type::to_char_type(ch);
+    return to_->sputc(traits_type::to_char_type(ch));
+  }
+  std::streamsize xsputn(const char *s, std::streamsize n) override {
+    copy_.append(s, n);
+    return to_->sputn(s, n);
+  }
+  int sync() override { return to_->pubsync(); }
+
+private:
+  std::streambuf *to_;
+  std::string &copy_;
+};
+
 void Exec(std::vector<char *> &argv, bool verbose = false) {
   if (verbose) {
     for (size_t j{0}; j < argv.size(); ++j) {
@@ -130,21 +269,27 @@ void Exec(std::vector<char *> &argv, bool verbose = false) {
     std::cerr << '\n';
   }
   argv.push_back(nullptr);
+  FlushWorkerOutput();
   execvp(argv[0], &argv[0]);
   std::cerr << "execvp(" << argv[0] << ") failed: " << std::strerror(errno)
             << '\n';
   exit(EXIT_FAILURE);
 }
 
+// A source of "-" is Fortran read from standard input.
 void RunOtherCompiler(DriverOptions &driver, char *source, char *relo) {
   std::vector<char *> argv;
   for (size_t j{0}; j < driver.pgf90Args.size(); ++j) {
     argv.push_back(driver.pgf90Args[j].data());
   }
-  char dashC[3] = "-c", dashO[3] = "-o";
+  char dashC[3] = "-c", dashO[3] = "-o", dashX[3] = "-x", f95[4] = "f95";
   argv.push_back(dashC);
   argv.push_back(dashO);
   argv.push_back(relo);
+  if (std::strcmp(source, "-") == 0) {
+    argv.push_back(dashX);
+    argv.push_back(f95);
+  }
   argv.push_back(source);
   Exec(argv, driver.verbose);
 }
@@ -169,18 +314,15 @@ std::string RelocatableName(const DriverOptions &driver, std::string path) {
 
 int exitStatus{EXIT_SUCCESS};
 
-std::string CompileFortran(std::string path, Fortran::parser::Options options,
-    DriverOptions &driver,
-    const Fortran::common::IntrinsicTypeDefaultKinds &defaultKinds) {
-  Fortran::parser::AllSources allSources;
-  allSources.set_encoding(driver.encoding);
-  Fortran::semantics::SemanticsContext semanticsContext{
-      defaultKinds, options.features, allSources};
-  semanticsContext.set_moduleDirectory(driver.moduleDirectory)
-      .set_moduleFileSuffix(driver.moduleFileSuffix)
-      .set_searchDirectories(driver.searchDirectories)
-      .set_warnOnNonstandardUsage(driver.warnOnNonstandardUsage)
-      .set_warningsAreErrors(driver.warningsAreErrors);
+// In a process forked by a compilation server (--server) for a request,
+// the server's context, with its resident modules, for use by
+// CompileFortran in place of a new one; likewise, with -fbatch, the
+// context that is shared by the compilations of all of the sources.
+Fortran::semantics::SemanticsContext *residentContext{nullptr};
+
+// Unless -Mfixed or -Mfree appeared, the source form follows the suffix.
+void SetSourceForm(const std::string &path, Fortran::parser::Options &options,
+    const DriverOptions &driver) {
   if (!driver.forcedForm) {
     auto dot{path.rfind(".")};
     if (dot != std::string::npos) {
@@ -188,9 +330,208 @@ std::string CompileFortran(std::string path, Fortran::parser::Options options,
       options.isFixedForm = suffix == "f" || suffix == "F" || suffix == "ff";
     }
   }
+}
+
+// The language settings that affect how a source file is understood
+void PutLanguageSettings(std::ostream &o,
+    const Fortran::parser::Options &options,
+    const Fortran::common::IntrinsicTypeDefaultKinds &defaultKinds) {
+  for (std::size_t j{0}; j < Fortran::common::TypeCategory_enumSize; ++j) {
+    o << defaultKinds.GetDefaultKind(
+             static_cast<Fortran::common::TypeCategory>(j))
+      << ' ';
+  }
+  o << defaultKinds.doublePrecisionKind() << ' '
+    << defaultKinds.quadPrecisionKind() << '\n';
+  for (std::size_t j{0}; j < Fortran::common::LanguageFeature_enumSize; ++j) {
+    auto feature{static_cast<Fortran::common::LanguageFeature>(j)};
+    o << options.features.IsEnabled(feature)
+      << options.features.ShouldWarn(feature);
+  }
+  o << '\n';
+}
+
+// With -fcache-dir, the results of a compilation are kept in a directory
+// of the cache named by a fingerprint of its inputs: the cooked character
+// stream, the options that can affect its results, and the headers of the
+// module files that it uses, which contain their checksums.  A later
+// compilation with the same fingerprint restores its module files,
+// messages, and relocatable from the cache without being parsed.
+struct CachedCompilation {
+  std::string key;  // the fingerprint
+  std::vector<std::string> moduleFiles;  // names of the files written
+  bool restored{false};
+};
+
+// Only compilations whose results are module files, messages, and
+// relocatables are cached.
+bool IsCacheable(
+    const DriverOptions &driver, const Fortran::parser::Options &options) {
+  return !driver.cacheDirectory.empty() && !driver.dumpProvenance &&
+      !driver.dumpCookedChars && !driver.dumpUnparse &&
+      !driver.dumpUnparseWithSymbols && !driver.dumpParseTree &&
+      !driver.dumpSymbols && !driver.measureTree && !driver.getDefinition &&
+      !driver.getSymbolsSources && !options.instrumentedParse &&
+      !driver.dumpParseMemoStatistics && !options.profileParse;
+}
+
+std::optional<std::string> ReadFileContents(const std::string &path) {
+  std::ifstream file{path, std::ios::binary};
+  if (!file) {
+    return std::nullopt;
+  }
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+bool WriteFileContents(const std::string &path, const std::string &contents) {
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  file << contents;
+  file.close();
+  return !file.fail();
+}
+
+std::string CacheKey(const Fortran::parser::CookedSource &cooked,
+    const Fortran::parser::Options &options, const DriverOptions &driver,
+    const Fortran::common::IntrinsicTypeDefaultKinds &defaultKinds,
+    const Fortran::parser::ModuleDependencies &dependencies) {
+  std::stringstream settings;
+  settings << "f18 " __DATE__ " " __TIME__ "\n"
+           << options.isFixedForm << ' ' << options.fixedFormColumns << ' '
+           << static_cast<int>(driver.encoding) << ' '
+           << driver.warnOnNonstandardUsage << driver.warningsAreErrors
+           << driver.debugSemantics << driver.debugResolveNames
+           << driver.parseOnly << driver.compileOnly
+           << driver.unparseTypedExprsToPGF90 << driver.interfaceHashes
+           << '\n'
+           << driver.moduleFileSuffix << '\n';
+  PutLanguageSettings(settings, options, defaultKinds);
+  for (const auto &arg : driver.pgf90Args) {
+    settings << arg << '\n';
+  }
+  Fortran::common::Fingerprint fingerprint;
+  fingerprint.Add(settings.str()).Add(cooked.data());
+  for (const auto &name : dependencies.uses) {
+    std::string header;
+    std::ifstream modFile{Fortran::parser::LocateSourceFile(
+        name + driver.moduleFileSuffix, driver.searchDirectories)};
+    std::getline(modFile, header);
+    fingerprint.Add(name).Add(header);
+  }
+  return fingerprint.ToString();
+}
+
+// Restores the results of a cached compilation; relo is empty when
+// there is no relocatable.
+bool RestoreCachedCompilation(const CachedCompilation &cached,
+    const std::string &relo, const DriverOptions &driver) {
+  std::string entry{driver.cacheDirectory + '/' + cached.key + '/'};
+  auto messages{ReadFileContents(entry + "messages")};
+  if (!messages) {
+    return false;
+  }
+  std::vector<std::pair<std::string, std::string>> files;  // path, contents
+  for (const auto &modFile : cached.moduleFiles) {
+    auto contents{ReadFileContents(entry + modFile)};
+    if (!contents) {
+      return false;
+    }
+    files.emplace_back(driver.moduleDirectory + '/' + modFile, *contents);
+  }
+  if (!relo.empty()) {
+    auto contents{ReadFileContents(entry + "object")};
+    if (!contents) {
+      return false;
+    }
+    files.emplace_back(relo, *contents);
+  }
+  for (const auto &[path, contents] : files) {
+    // As with module files written by semantics, an unchanged file is not
+    // rewritten, so that its modification time is preserved.
+    if (ReadFileContents(path) != contents &&
+        !WriteFileContents(path, contents)) {
+      return false;
+    }
+  }
+  std::cerr << *messages;
+  return true;
+}
+
+// Stores the results of a compilation in a new entry of the cache.
+// The entry is written under a temporary name and then renamed, so that
+// a concurrent compilation never sees an incomplete entry.
+void StoreCachedCompilation(const CachedCompilation &cached,
+    const std::string &relo, const std::string &messages,
+    const DriverOptions &driver) {
+  mkdir(driver.cacheDirectory.c_str(), 0777);  // if it does not yet exist
+  std::string temp{driver.cacheDirectory + "/tmp-XXXXXX"};
+  if (!mkdtemp(&temp[0])) {
+    return;
+  }
+  std::vector<std::string> written;
+  auto put{[&](const std::string &name,
+               const std::optional<std::string> &contents) {
+    written.push_back(temp + '/' + name);
+    return contents && WriteFileContents(written.back(), *contents);
+  }};
+  bool ok{put("messages", messages)};
+  for (const auto &modFile : cached.moduleFiles) {
+    ok = ok &&
+        put(modFile,
+            ReadFileContents(driver.moduleDirectory + '/' + modFile));
+  }
+  if (!relo.empty()) {
+    ok = ok && put("object", ReadFileContents(relo));
+  }
+  std::string entry{driver.cacheDirectory + '/' + cached.key};
+  if (!ok || std::rename(temp.c_str(), entry.c_str()) != 0) {
+    // failed, or another compilation stored the same entry first
+    for (const auto &path : written) {
+      unlink(path.c_str());
+    }
+    rmdir(temp.c_str());
+  }
+}
+
+std::string CompileFortranFile(std::string path,
+    Fortran::parser::Options options, DriverOptions &driver,
+    const Fortran::common::IntrinsicTypeDefaultKinds &defaultKinds,
+    CachedCompilation *cache = nullptr) {
+  Fortran::parser::AllSources allSources;
+  allSources.set_encoding(driver.encoding);
+  std::optional<Fortran::semantics::SemanticsContext> ownContext;
+  auto *context{std::exchange(residentContext, nullptr)};
+  if (!context) {
+    context = &ownContext.emplace(defaultKinds, options.features, allSources);
+  }
+  Fortran::semantics::SemanticsContext &semanticsContext{*context};
+  semanticsContext.set_moduleDirectory(driver.moduleDirectory)
+      .set_moduleFileSuffix(driver.moduleFileSuffix)
+      .set_parseTreeDirectory(driver.parseTreeDirectory)
+      .set_writeInterfaceHashes(driver.interfaceHashes)
+      .set_searchDirectories(driver.searchDirectories)
+      .set_warnOnNonstandardUsage(driver.warnOnNonstandardUsage)
+      .set_warningsAreErrors(driver.warningsAreErrors)
+      .set_timeReport(options.timeReport);
+  SetSourceForm(path, options, driver);
   options.searchDirectories = driver.searchDirectories;
   Fortran::parser::Parsing parsing{semanticsContext.allSources()};
-  parsing.Prescan(path, options);
+  // With -fparse-tree-cache, the parse tree of an unchanged source file
+  // is loaded instead of being prescanned and parsed again, unless the
+  // output of those phases was requested.
+  std::string parseTreeFile;
+  if (!driver.parseTreeDirectory.empty() && path != "-" &&
+      !driver.dumpProvenance && !options.instrumentedParse &&
+      !driver.dumpParseMemoStatistics && !options.profileParse) {
+    parseTreeFile = Fortran::parser::ParseTreeFileName(
+        driver.parseTreeDirectory, path, options);
+  }
+  bool loadedParseTree{!parseTreeFile.empty() &&
+      parsing.LoadParseTree(parseTreeFile, path, options)};
+  if (!loadedParseTree) {
+    parsing.Prescan(path, options);
+  }
   if (!parsing.messages().empty() &&
       (driver.warningsAreErrors || parsing.messages().AnyFatalError())) {
     std::cerr << driver.prefix << "could not scan " << path << '\n';
@@ -207,12 +548,44 @@ std::string CompileFortran(std::string path, Fortran::parser::Options options,
     parsing.DumpCookedChars(std::cout);
     return {};
   }
-  parsing.Parse(&std::cout);
+  if (cache) {
+    Fortran::common::TimeReport::Phase phase{options.timeReport, "Cache"};
+    auto dependencies{
+        Fortran::parser::ScanModuleDependencies(parsing.cooked())};
+    cache->key = CacheKey(
+        parsing.cooked(), options, driver, defaultKinds, dependencies);
+    if (driver.debugSemantics || driver.debugResolveNames) {
+      for (const auto &name : dependencies.defines) {
+        std::string modFile{name + driver.moduleFileSuffix};
+        cache->moduleFiles.push_back(modFile);
+        if (driver.interfaceHashes) {
+          cache->moduleFiles.push_back(modFile + ".ihash");
+        }
+      }
+    }
+    std::string relo{driver.parseOnly ? ""s : RelocatableName(driver, path)};
+    if (RestoreCachedCompilation(*cache, relo, driver)) {
+      cache->restored = true;
+      if (!relo.empty() && !driver.compileOnly && driver.outputPath.empty()) {
+        filesToDelete.push_back(relo);
+      }
+      return relo;
+    }
+  }
+  if (!loadedParseTree) {
+    parsing.Parse(&std::cout);
+  }
   if (options.instrumentedParse) {
     parsing.DumpParsingLog(std::cout);
     return {};
   }
   parsing.ClearLog();
+  if (driver.dumpParseMemoStatistics) {
+    parsing.DumpParseMemoStatistics(std::cerr);
+  }
+  if (options.profileParse) {
+    parsing.DumpParserProfile(std::cerr, driver.parserProfileTop);
+  }
   parsing.messages().Emit(std::cerr, parsing.cooked());
   if (!parsing.consumedWholeFile()) {
     parsing.EmitMessage(
@@ -227,6 +600,9 @@ std::string CompileFortran(std::string path, Fortran::parser::Options options,
     exitStatus = EXIT_FAILURE;
     return {};
   }
+  if (!loadedParseTree && !parseTreeFile.empty()) {
+    parsing.SaveParseTree(parseTreeFile);
+  }
   auto &parseTree{*parsing.parseTree()};
   if (driver.measureTree) {
     MeasureParseTree(parseTree);
@@ -310,6 +686,52 @@ std::string CompileFortran(std::string path, Fortran::parser::Options options,
   }
 
   std::string relo{RelocatableName(driver, path)};
+  auto unparseForBackend{[&](std::ostream &out) {
+    Fortran::common::TimeReport::Phase phase{options.timeReport, "Unparse"};
+    Fortran::evaluate::formatForPGF90 = true;
+    Unparse(out, parseTree, driver.encoding, true /*capitalize*/,
+        options.features.IsEnabled(
+            Fortran::common::LanguageFeature::BackslashEscapes),
+        nullptr /* action before each statement */,
+        driver.unparseTypedExprsToPGF90 ? &unparseExpression : nullptr);
+    Fortran::evaluate::formatForPGF90 = false;
+  }};
+
+  if (driver.pipeToBackend) {
+    // The backend compiler reads the unparsed source from its standard
+    // input while it is being produced; no temporary file is written.
+    int fds[2];
+    if (pipe(fds) != 0) {
+      std::cerr << driver.prefix << "pipe() failed: " << std::strerror(errno)
+                << '\n';
+      exitStatus = EXIT_FAILURE;
+      return {};
+    }
+    pid_t pid{ForkChild()};
+    if (pid == 0) {
+      close(fds[1]);
+      dup2(fds[0], STDIN_FILENO);
+      close(fds[0]);
+      char dash[2] = "-";
+      RunOtherCompiler(driver, dash, relo.data());
+    }
+    close(fds[0]);
+    {
+      // If the backend quits early, it will report why.
+      auto *oldHandler{signal(SIGPIPE, SIG_IGN)};
+      FileDescriptorBuffer buffer{fds[1]};
+      std::ostream pipeSource{&buffer};
+      unparseForBackend(pipeSource);
+      pipeSource.flush();
+      signal(SIGPIPE, oldHandler);
+    }
+    close(fds[1]);
+    WaitForChild(pid);
+    if (!driver.compileOnly && driver.outputPath.empty()) {
+      filesToDelete.push_back(relo);
+    }
+    return relo;
+  }
 
   char tmpSourcePath[32];
   std::snprintf(tmpSourcePath, sizeof tmpSourcePath, "/tmp/f18-%lx.f90",
@@ -317,13 +739,7 @@ std::string CompileFortran(std::string path, Fortran::parser::Options options,
   {
     std::ofstream tmpSource;
     tmpSource.open(tmpSourcePath);
-    Fortran::evaluate::formatForPGF90 = true;
-    Unparse(tmpSource, parseTree, driver.encoding, true /*capitalize*/,
-        options.features.IsEnabled(
-            Fortran::common::LanguageFeature::BackslashEscapes),
-        nullptr /* action before each statement */,
-        driver.unparseTypedExprsToPGF90 ? &unparseExpression : nullptr);
-    Fortran::evaluate::formatForPGF90 = false;
+    unparseForBackend(tmpSource);
   }
 
   if (ParentProcess()) {
@@ -337,6 +753,203 @@ std::string CompileFortran(std::string path, Fortran::parser::Options options,
   return {};
 }
 
+std::string CompileFortran(std::string path, Fortran::parser::Options options,
+    DriverOptions &driver,
+    const Fortran::common::IntrinsicTypeDefaultKinds &defaultKinds) {
+  std::optional<Fortran::common::TimeReport> fileTimeReport;
+  if (driver.timeReport) {
+    options.timeReport = &fileTimeReport.emplace();
+  }
+  std::string relo;
+  if (IsCacheable(driver, options)) {
+    // Messages are copied as they are written, to be cached.
+    CachedCompilation cached;
+    std::string messages;
+    TeeBuffer tee{std::cerr.rdbuf(), messages};
+    auto *savedBuffer{std::cerr.rdbuf(&tee)};
+    int priorStatus{std::exchange(exitStatus, EXIT_SUCCESS)};
+    relo = CompileFortranFile(path, options, driver, defaultKinds, &cached);
+    std::cerr.rdbuf(savedBuffer);
+    if (!cached.key.empty() && !cached.restored &&
+        exitStatus == EXIT_SUCCESS) {
+      StoreCachedCompilation(cached, relo, messages, driver);
+    }
+    if (priorStatus != EXIT_SUCCESS) {
+      exitStatus = priorStatus;
+    }
+  } else {
+    relo = CompileFortranFile(path, options, driver, defaultKinds);
+  }
+  if (fileTimeReport) {
+    totalTimeReport.Merge(*fileTimeReport);
+    if (!driver.timeReportJSON.empty()) {
+      std::ofstream json{driver.timeReportJSON, std::ios::app};
+      fileTimeReport->DumpJSON(json, path);
+    }
+  }
+  return relo;
+}
+
+// Prescans a source file and recognizes its MODULE, SUBMODULE, and USE
+// statements.  Errors are left to be reported by its compilation.
+// If files is not null, it receives the paths of the source file and
+// of the files that it includes.
+Fortran::parser::ModuleDependencies ScanFortranSource(std::string path,
+    Fortran::parser::Options options, const DriverOptions &driver,
+    std::vector<std::string> *files = nullptr) {
+  Fortran::parser::AllSources allSources;
+  allSources.set_encoding(driver.encoding);
+  SetSourceForm(path, options, driver);
+  options.searchDirectories = driver.searchDirectories;
+  Fortran::parser::Parsing parsing{allSources};
+  parsing.Prescan(path, options);
+  if (files) {
+    *files = allSources.GetSourceFilePaths();
+  }
+  return Fortran::parser::ScanModuleDependencies(parsing.cooked());
+}
+
+// Escapes a path for use in a Makefile rule or a ninja build statement.
+std::string DependencyPath(const std::string &path, bool ninja) {
+  std::string result;
+  for (char ch : path) {
+    if (ninja) {
+      if (ch == ' ' || ch == ':' || ch == '$') {
+        result += '$';
+      }
+    } else if (ch == ' ' || ch == '#') {
+      result += '\\';
+    } else if (ch == '$') {
+      result += '$';
+    }
+    result += ch;
+  }
+  return result;
+}
+
+// Compiles Fortran source files in up to driver.jobs worker processes.
+// A file's compilation does not begin until the compilations of the
+// other files that define the modules that it uses have completed and
+// written their module files.  Relocatables are returned in the order
+// of the sources.
+void CompileFortranInParallel(const std::vector<std::string> &sources,
+    const Fortran::parser::Options &options, DriverOptions &driver,
+    const Fortran::common::IntrinsicTypeDefaultKinds &defaultKinds,
+    std::vector<std::string> &relocatables) {
+  std::size_t n{sources.size()};
+  std::vector<Fortran::parser::ModuleDependencies> dependencies;
+  std::map<std::string, std::size_t> definer;
+  for (std::size_t j{0}; j < n; ++j) {
+    dependencies.emplace_back(ScanFortranSource(sources[j], options, driver));
+    for (const auto &name : dependencies[j].defines) {
+      definer.emplace(name, j);
+    }
+  }
+  std::vector<std::set<std::size_t>> predecessors(n), successors(n);
+  for (std::size_t j{0}; j < n; ++j) {
+    for (const auto &name : dependencies[j].uses) {
+      auto iter{definer.find(name)};
+      if (iter != definer.end() && iter->second != j) {
+        predecessors[j].insert(iter->second);
+        successors[iter->second].insert(j);
+      }
+    }
+  }
+
+  struct Worker {
+    std::size_t source;
+    int pipe;  // read end; receives the name of the relocatable
+  };
+  std::set<std::size_t> pending;
+  for (std::size_t j{0}; j < n; ++j) {
+    pending.insert(j);
+  }
+  std::map<pid_t, Worker> running;
+  std::vector<std::string> relos(n);
+  while (!pending.empty() || !running.empty()) {
+    while (running.size() < static_cast<std::size_t>(driver.jobs) &&
+        !pending.empty()) {
+      auto ready{pending.begin()};
+      while (ready != pending.end() && !predecessors[*ready].empty()) {
+        ++ready;
+      }
+      if (ready == pending.end()) {
+        if (!running.empty()) {
+          break;  // wait for a predecessor to complete
+        }
+        ready = pending.begin();  // circular dependence; let it fail
+      }
+      std::size_t j{*ready};
+      pending.erase(ready);
+      int fds[2];
+      if (pipe(fds) != 0) {
+        std::cerr << driver.prefix << "pipe() failed: " << std::strerror(errno)
+                  << '\n';
+        exit(EXIT_FAILURE);
+      }
+      pid_t pid{fork()};
+      if (pid == 0) {
+        // Worker process: the parent owns the files to be deleted at exit.
+        close(fds[0]);
+        filesToDelete.clear();
+        BufferWorkerOutput();
+        std::string relo{
+            CompileFortran(sources[j], options, driver, defaultKinds)};
+        filesToDelete.erase(
+            std::remove(filesToDelete.begin(), filesToDelete.end(), relo),
+            filesToDelete.end());
+        CleanUpAtExit();
+        if (write(fds[1], relo.data(), relo.size()) !=
+            static_cast<ssize_t>(relo.size())) {
+          exitStatus = EXIT_FAILURE;
+        }
+        close(fds[1]);
+        _exit(exitStatus);
+      }
+      close(fds[1]);
+      if (pid < 0) {
+        std::cerr << driver.prefix << "fork() failed: " << std::strerror(errno)
+                  << '\n';
+        exit(EXIT_FAILURE);
+      }
+      running.emplace(pid, Worker{j, fds[0]});
+    }
+    if (running.empty()) {
+      continue;
+    }
+    int childStat{0};
+    pid_t pid{waitpid(-1, &childStat, 0)};
+    auto iter{running.find(pid)};
+    if (iter == running.end()) {
+      continue;
+    }
+    Worker worker{iter->second};
+    running.erase(iter);
+    char buffer[256];
+    std::string relo;
+    for (ssize_t got; (got = read(worker.pipe, buffer, sizeof buffer)) > 0;) {
+      relo.append(buffer, got);
+    }
+    close(worker.pipe);
+    if (!WIFEXITED(childStat) || WEXITSTATUS(childStat) != 0) {
+      exitStatus = EXIT_FAILURE;
+    } else if (!relo.empty()) {
+      relos[worker.source] = relo;
+      if (!driver.compileOnly && driver.outputPath.empty()) {
+        filesToDelete.push_back(relo);
+      }
+    }
+    for (std::size_t successor : successors[worker.source]) {
+      predecessors[successor].erase(worker.source);
+    }
+  }
+  for (auto &relo : relos) {
+    if (!driver.compileOnly && !relo.empty()) {
+      relocatables.emplace_back(std::move(relo));
+    }
+  }
+}
+
 std::string CompileOtherLanguage(std::string path, DriverOptions &driver) {
   std::string relo{RelocatableName(driver, path)};
   if (ParentProcess()) {
@@ -367,22 +980,30 @@ void Link(std::vector<std::string> &relocatables, DriverOptions &driver) {
   }
 }
 
-int main(int argc, char *const argv[]) {
-
-  atexit(CleanUpAtExit);
-
+// The processed options and files of a driver command line
+struct CommandLine {
+  explicit CommandLine(const std::string &p) : prefix{p} {
+    driver.prefix = prefix.data();
+  }
+  CommandLine(const CommandLine &) = delete;
+  std::string prefix;
   DriverOptions driver;
+  Fortran::parser::Options options;
+  Fortran::common::IntrinsicTypeDefaultKinds defaultKinds;
+  std::vector<std::string> fortranSources, otherSources, relocatables;
+  bool anyFiles{false};
+};
+
+// Returns an exit status when the command line is complete without
+// compilation, as it is for -help, or erroneous.
+std::optional<int> ProcessCommandLine(
+    std::list<std::string> args, CommandLine &commandLine) {
+  DriverOptions &driver{commandLine.driver};
   const char *pgf90{getenv("F18_FC")};
   driver.pgf90Args.push_back(pgf90 ? pgf90 : "pgf90");
   bool isPGF90{driver.pgf90Args.back().rfind("pgf90") != std::string::npos};
 
-  std::list<std::string> args{argList(argc, argv)};
-  std::string prefix{args.front()};
-  args.pop_front();
-  prefix += ": ";
-  driver.prefix = prefix.data();
-
-  Fortran::parser::Options options;
+  Fortran::parser::Options &options{commandLine.options};
   options.predefinitions.emplace_back("__F18", "1");
   options.predefinitions.emplace_back("__F18_MAJOR__", "1");
   options.predefinitions.emplace_back("__F18_MINOR__", "1");
@@ -391,17 +1012,31 @@ int main(int argc, char *const argv[]) {
   options.predefinitions.emplace_back("__x86_64__", "1");
 #endif
 
-  Fortran::common::IntrinsicTypeDefaultKinds defaultKinds;
-
-  std::vector<std::string> fortranSources, otherSources, relocatables;
-  bool anyFiles{false};
+  Fortran::common::IntrinsicTypeDefaultKinds &defaultKinds{
+      commandLine.defaultKinds};
+  std::vector<std::string> &fortranSources{commandLine.fortranSources};
+  std::vector<std::string> &otherSources{commandLine.otherSources};
+  std::vector<std::string> &relocatables{commandLine.relocatables};
 
   while (!args.empty()) {
     std::string arg{std::move(args.front())};
     args.pop_front();
     if (arg.empty()) {
+    } else if (arg.at(0) == '@') {
+      // a response file holds more arguments, separated by white space
+      std::ifstream file{arg.substr(1)};
+      if (!file) {
+        std::cerr << driver.prefix << "cannot read response file "
+                  << arg.substr(1) << '\n';
+        return EXIT_FAILURE;
+      }
+      std::list<std::string> more;
+      for (std::string word; file >> word;) {
+        more.push_back(word);
+      }
+      args.splice(args.begin(), more);
     } else if (arg.at(0) != '-') {
-      anyFiles = true;
+      commandLine.anyFiles = true;
       auto dot{arg.rfind(".")};
       if (dot == std::string::npos) {
         driver.pgf90Args.push_back(arg);
@@ -477,6 +1112,39 @@ int main(int argc, char *const argv[]) {
       driver.measureTree = true;
     } else if (arg == "-fdebug-instrumented-parse") {
       options.instrumentedParse = true;
+    } else if (arg == "-fparse-memo") {
+      options.memoizeParse = true;
+    } else if (arg == "-fdebug-parse-memo-stats") {
+      options.memoizeParse = true;
+      driver.dumpParseMemoStatistics = true;
+    } else if (arg == "-fdebug-parser-profile") {
+      options.profileParse = true;
+      driver.parserProfileTop = 20;
+    } else if (arg.substr(0, 23) == "-fdebug-parser-profile=") {
+      std::string top{arg.substr(23)};
+      char *endptr;
+      driver.parserProfileTop = std::strtol(top.c_str(), &endptr, 10);
+      if (top.empty() || *endptr != '\0' || driver.parserProfileTop < 1) {
+        std::cerr << "Invalid argument to -fdebug-parser-profile: " << top
+                  << '\n';
+        return EXIT_FAILURE;
+      }
+      options.profileParse = true;
+    } else if (arg.substr(0, 16) == "-fparse-threads=") {
+      std::string threads{arg.substr(16)};
+      char *endptr;
+      options.parseThreads = std::strtol(threads.c_str(), &endptr, 10);
+      if (threads.empty() || *endptr != '\0' || options.parseThreads < 1) {
+        std::cerr << "Invalid argument to -fparse-threads: " << threads
+                  << '\n';
+        return EXIT_FAILURE;
+      }
+    } else if (arg == "-ftime-report") {
+      driver.timeReport = true;
+    } else if (arg == "-ftime-report-json") {
+      driver.timeReport = true;
+      driver.timeReportJSON = args.front();
+      args.pop_front();
     } else if (arg == "-fdebug-semantics") {
       // TODO: Enable by default once basic tests pass
       driver.debugSemantics = true;
@@ -488,6 +1156,24 @@ int main(int argc, char *const argv[]) {
       driver.unparseTypedExprsToPGF90 = true;
     } else if (arg == "-fparse-only") {
       driver.parseOnly = true;
+    } else if (arg == "-pipe") {
+      driver.pipeToBackend = true;
+    } else if (arg == "-fmodule-interface-hash") {
+      driver.interfaceHashes = true;
+    } else if (arg == "-fcache-dir") {
+      driver.cacheDirectory = args.front();
+      args.pop_front();
+    } else if (arg == "-fparse-tree-cache") {
+      driver.parseTreeDirectory = args.front();
+      args.pop_front();
+    } else if (arg == "-fbatch") {
+      driver.batch = true;
+    } else if (arg == "-fdeps-scan") {
+      driver.scanDependencies = true;
+    } else if (arg == "-fdeps-format=make") {
+      driver.ninjaDependencies = false;
+    } else if (arg == "-fdeps-format=ninja") {
+      driver.ninjaDependencies = true;
     } else if (arg == "-c") {
       driver.compileOnly = true;
     } else if (arg == "-o") {
@@ -543,6 +1229,18 @@ int main(int argc, char *const argv[]) {
       driver.getDefinitionArgs = {arguments[0], arguments[1], arguments[2]};
     } else if (arg == "-fget-symbols-sources") {
       driver.getSymbolsSources = true;
+    } else if (arg.substr(0, 2) == "-j") {
+      std::string jobs{arg.substr(2)};
+      if (jobs.empty() && !args.empty()) {
+        jobs = args.front();
+        args.pop_front();
+      }
+      char *endptr;
+      driver.jobs = std::strtol(jobs.c_str(), &endptr, 10);
+      if (jobs.empty() || *endptr != '\0' || driver.jobs < 1) {
+        std::cerr << "Invalid argument to -j: " << jobs << '\n';
+        return EXIT_FAILURE;
+      }
     } else if (arg == "-help" || arg == "--help" || arg == "-?") {
       std::cerr
           << "f18 options:\n"
@@ -571,10 +1269,41 @@ int main(int argc, char *const argv[]) {
           << "  -fdebug-dump-symbols\n"
           << "  -fdebug-resolve-names\n"
           << "  -fdebug-instrumented-parse\n"
+          << "  -fparse-memo         memoize backtracking statement parsers\n"
+          << "  -fdebug-parse-memo-stats  also report memoization hit rates\n"
+          << "  -fdebug-parser-profile[=N]  report the N (20) hottest "
+             "productions\n"
+          << "  -fparse-threads=N    parse the program units of a source "
+             "file on N threads\n"
           << "  -fdebug-semantics    perform semantic checks\n"
+          << "  -ftime-report        report time & memory used by each "
+             "phase\n"
+          << "  -ftime-report-json file  also append the report as JSON\n"
+          << "  -fdeps-scan          write make rules for module files "
+             "& includes\n"
+          << "  -fdeps-format=ninja  write a ninja dyndep file instead\n"
           << "  -fget-definition\n"
           << "  -fget-symbols-sources\n"
+          << "  -fmodule-interface-hash  also write a hash of each module's "
+             "public interface\n"
+          << "                       to <module file>.ihash, only when it "
+             "changes\n"
+          << "  -fcache-dir dir      reuse the results of unchanged "
+             "compilations\n"
+          << "  -fparse-tree-cache dir  reuse the parse trees of unchanged "
+             "sources\n"
+          << "                       and module files\n"
+          << "  -fbatch              compile Fortran sources in one process, "
+             "sharing modules\n"
+          << "  -j N                 compile up to N Fortran sources at once\n"
+          << "  -pipe                pipe unparsed source to the compiler's "
+             "standard input\n"
+          << "  --server socket      serve compilations on a socket, keeping "
+             "modules resident\n"
+          << "  --client socket      compile by means of a server, if one is "
+             "running\n"
           << "  -v -c -o -I -D -U    have their usual meanings\n"
+          << "  @file                read more arguments from a file\n"
           << "  -help                print this again\n"
           << "Other options are passed through to the compiler.\n";
       return exitStatus;
@@ -610,20 +1339,135 @@ int main(int argc, char *const argv[]) {
   } else {
     // TODO: equivalents for other Fortran compilers
   }
+  return std::nullopt;
+}
 
-  if (!anyFiles) {
+// Implements -fdeps-scan: for each Fortran source, writes a Makefile rule
+// or a ninja dyndep build statement that makes its relocatable and the
+// module files that it produces depend on the module files that it
+// consumes and the files that it includes.  A consumed module file that
+// none of the sources produce is looked for in the search directories.
+// With -fmodule-interface-hash, a source depends on the interface hashes
+// of the modules produced by the others instead of their module files.
+int ScanDependencies(const CommandLine &commandLine) {
+  const DriverOptions &driver{commandLine.driver};
+  bool ninja{driver.ninjaDependencies};
+  std::ofstream file;
+  if (!driver.outputPath.empty()) {
+    file.open(driver.outputPath);
+    if (!file) {
+      std::cerr << driver.outputPath << ": cannot write dependencies\n";
+      return EXIT_FAILURE;
+    }
+  }
+  std::ostream &out{driver.outputPath.empty() ? std::cout : file};
+  auto moduleFilePath{[&](const std::string &name) {
+    return driver.moduleDirectory + '/' + name + driver.moduleFileSuffix;
+  }};
+  std::vector<Fortran::parser::ModuleDependencies> dependencies;
+  std::vector<std::vector<std::string>> files;
+  std::set<std::string> produced;
+  for (const auto &path : commandLine.fortranSources) {
+    files.emplace_back();
+    dependencies.emplace_back(ScanFortranSource(
+        path, commandLine.options, driver, &files.back()));
+    produced.insert(
+        dependencies.back().defines.begin(), dependencies.back().defines.end());
+  }
+  if (ninja) {
+    out << "ninja_dyndep_version = 1\n";
+  }
+  DriverOptions naming;  // relocatable names ignore -o here
+  for (std::size_t j{0}; j < dependencies.size(); ++j) {
+    const std::string &path{commandLine.fortranSources[j]};
+    out << (ninja ? "build " : "")
+        << DependencyPath(RelocatableName(naming, path), ninja);
+    if (ninja && !dependencies[j].defines.empty()) {
+      out << " |";
+    }
+    for (const auto &name : dependencies[j].defines) {
+      out << ' ' << DependencyPath(moduleFilePath(name), ninja);
+      if (driver.interfaceHashes) {
+        out << ' ' << DependencyPath(moduleFilePath(name) + ".ihash", ninja);
+      }
+    }
+    out << (ninja ? ": dyndep" : ":");
+    bool anyInputs{false};
+    auto input{[&](const std::string &input) {
+      if (ninja && !anyInputs) {
+        out << " |";
+      }
+      anyInputs = true;
+      out << ' ' << DependencyPath(input, ninja);
+    }};
+    for (const auto &included : files[j]) {
+      if (!ninja || included != path) {  // ninja knows its explicit input
+        input(included);
+      }
+    }
+    for (const auto &name : dependencies[j].uses) {
+      std::string modFile{name + driver.moduleFileSuffix};
+      std::string located;
+      if (produced.find(name) == produced.end()) {
+        located = Fortran::parser::LocateSourceFile(
+            modFile, driver.searchDirectories);
+      } else if (driver.interfaceHashes) {
+        // rebuild only when the module's interface changes
+        located = moduleFilePath(name) + ".ihash";
+      }
+      input(located.empty() || located == modFile ? moduleFilePath(name)
+                                                  : located);
+    }
+    out << '\n';
+  }
+  return EXIT_SUCCESS;
+}
+
+int Compile(CommandLine &commandLine) {
+  DriverOptions &driver{commandLine.driver};
+  const Fortran::parser::Options &options{commandLine.options};
+  const auto &defaultKinds{commandLine.defaultKinds};
+  const auto &fortranSources{commandLine.fortranSources};
+  std::vector<std::string> &relocatables{commandLine.relocatables};
+  if (driver.scanDependencies) {
+    return ScanDependencies(commandLine);
+  }
+  if (!commandLine.anyFiles) {
     driver.measureTree = true;
     driver.dumpUnparse = true;
     CompileFortran("-", options, driver, defaultKinds);
     return exitStatus;
   }
-  for (const auto &path : fortranSources) {
-    std::string relo{CompileFortran(path, options, driver, defaultKinds)};
-    if (!driver.compileOnly && !relo.empty()) {
-      relocatables.push_back(relo);
+  if (driver.jobs > 1 && fortranSources.size() > 1 &&
+      std::find(fortranSources.begin(), fortranSources.end(), "-") ==
+          fortranSources.end()) {
+    CompileFortranInParallel(
+        fortranSources, options, driver, defaultKinds, relocatables);
+  } else if (driver.batch && fortranSources.size() > 1) {
+    // One context serves all of the compilations, so the intrinsic
+    // procedure table is built once and each module file is read once.
+    Fortran::parser::AllSources allSources;
+    allSources.set_encoding(driver.encoding);
+    Fortran::semantics::SemanticsContext context{
+        defaultKinds, options.features, allSources};
+    for (const auto &path : fortranSources) {
+      residentContext = &context;
+      std::string relo{CompileFortran(path, options, driver, defaultKinds)};
+      residentContext = nullptr;
+      context.ResetForNextCompilation();
+      if (!driver.compileOnly && !relo.empty()) {
+        relocatables.push_back(relo);
+      }
+    }
+  } else {
+    for (const auto &path : fortranSources) {
+      std::string relo{CompileFortran(path, options, driver, defaultKinds)};
+      if (!driver.compileOnly && !relo.empty()) {
+        relocatables.push_back(relo);
+      }
     }
   }
-  for (const auto &path : otherSources) {
+  for (const auto &path : commandLine.otherSources) {
     std::string relo{CompileOtherLanguage(path, driver)};
     if (!driver.compileOnly && !relo.empty()) {
       relocatables.push_back(relo);
@@ -634,3 +1478,371 @@ int main(int argc, char *const argv[]) {
   }
   return exitStatus;
 }
+
+// The options that affect the reading of module files.  A request to a
+// compilation server can use its resident modules only when they agree.
+std::string ResidentKey(const CommandLine &commandLine) {
+  std::stringstream key;
+  char cwd[PATH_MAX];
+  key << (getcwd(cwd, sizeof cwd) ? cwd : "") << '\n';
+  for (const auto &dir : commandLine.driver.searchDirectories) {
+    key << dir << '\n';
+  }
+  key << commandLine.driver.moduleFileSuffix << '\n'
+      << static_cast<int>(commandLine.driver.encoding) << '\n';
+  PutLanguageSettings(key, commandLine.options, commandLine.defaultKinds);
+  return key.str();
+}
+
+// A compilation server keeps a SemanticsContext whose intrinsic procedure
+// table and modules read from module files remain resident across
+// requests.  Each request is compiled in a forked process that inherits
+// the context.  Resident modules are set aside in the context so that a
+// request sees only those that it uses, as if they had just been read.
+class ResidentState {
+public:
+  explicit ResidentState(const CommandLine &config)
+    : config_{config}, context_{config.defaultKinds, config.options.features,
+                           allSources_} {
+    allSources_.set_encoding(config.driver.encoding);
+    context_.set_searchDirectories(config.driver.searchDirectories)
+        .set_moduleFileSuffix(config.driver.moduleFileSuffix);
+  }
+
+  Fortran::semantics::SemanticsContext &context() { return context_; }
+
+  // Have any of the resident modules' files changed?
+  bool IsCurrent() const {
+    for (const auto &[path, header] : moduleFiles_) {
+      if (ReadHeader(path) != header) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Reads modules into the context; false if anything went wrong, in
+  // which case the context should be discarded.
+  bool Read(const std::set<std::string> &names) {
+    for (const auto &name : names) {
+      if (modules_.find(name) == modules_.end()) {
+        Fortran::semantics::ModFileReader{context_}.Read(
+            Fortran::parser::CharBlock{name});
+        if (!context_.messages().empty()) {
+          return false;
+        }
+      }
+    }
+    // Record the files of all of the modules just read, including
+    // those read indirectly, before setting them aside.
+    for (const auto &pair : context_.globalScope()) {
+      if (pair.second->test(Fortran::semantics::Symbol::Flag::ModFile)) {
+        std::string name{pair.first.ToString()};
+        std::string path{Fortran::parser::LocateSourceFile(
+            name + config_.driver.moduleFileSuffix,
+            config_.driver.searchDirectories)};
+        modules_.insert(name);
+        moduleFiles_[path] = ReadHeader(path);
+      }
+    }
+    context_.SetAsideModFileModules();
+    return true;
+  }
+
+private:
+  // The first line of a module file contains its checksum.
+  static std::string ReadHeader(const std::string &path) {
+    std::ifstream stream{path};
+    std::string header;
+    std::getline(stream, header);
+    return header;
+  }
+
+  const CommandLine &config_;
+  Fortran::parser::AllSources allSources_;
+  Fortran::semantics::SemanticsContext context_;
+  std::set<std::string> modules_;
+  std::map<std::string, std::string> moduleFiles_;  // path -> header
+};
+
+// A client sends its working directory and command line arguments to the
+// server as a count followed by NUL-terminated strings, passing its
+// standard input, output, and error along with them.  The server's
+// reply is the exit status of the compilation.
+struct ServerRequest {
+  std::string cwd;
+  std::list<std::string> args;
+  int fds[3];
+};
+
+static constexpr int requestFds{3};
+
+std::optional<ServerRequest> ReceiveRequest(int connection) {
+  char buffer[4096];
+  char control[CMSG_SPACE(requestFds * sizeof(int))];
+  iovec iov{buffer, sizeof buffer};
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof control;
+  ssize_t got{recvmsg(connection, &msg, 0)};
+  cmsghdr *cmsg{CMSG_FIRSTHDR(&msg)};
+  if (got <= 0 || !cmsg || cmsg->cmsg_level != SOL_SOCKET ||
+      cmsg->cmsg_type != SCM_RIGHTS ||
+      cmsg->cmsg_len != CMSG_LEN(requestFds * sizeof(int))) {
+    return std::nullopt;
+  }
+  ServerRequest request;
+  std::memcpy(request.fds, CMSG_DATA(cmsg), sizeof request.fds);
+  std::string data{buffer, static_cast<std::size_t>(got)};
+  std::size_t count{0};
+  while (true) {
+    if (count == 0 && data.find('\0') != std::string::npos) {
+      count = std::strtoul(data.data(), nullptr, 10) + 1;
+    }
+    if (count > 0 &&
+        static_cast<std::size_t>(std::count(data.begin(), data.end(), '\0')) >=
+            count) {
+      break;
+    }
+    got = read(connection, buffer, sizeof buffer);
+    if (got <= 0) {
+      for (int fd : request.fds) {
+        close(fd);
+      }
+      return std::nullopt;
+    }
+    data.append(buffer, got);
+  }
+  std::size_t at{data.find('\0') + 1};
+  for (std::size_t j{1}; j < count; ++j) {
+    std::size_t end{data.find('\0', at)};
+    std::string str{data.substr(at, end - at)};
+    if (j == 1) {
+      request.cwd = std::move(str);
+    } else {
+      request.args.emplace_back(std::move(str));
+    }
+    at = end + 1;
+  }
+  return request;
+}
+
+// Compiles a request in a process forked by the server, whose standard
+// streams are now those of the client.  The names of the modules that
+// were read are written to the report descriptor so that the server
+// can make them resident.
+int ServeRequest(const ServerRequest &request, const CommandLine &config,
+    ResidentState *resident, const std::string &residentKey, int report) {
+  if (chdir(request.cwd.c_str()) != 0) {
+    std::cerr << config.prefix << "cannot change to directory "
+              << request.cwd << ": " << std::strerror(errno) << '\n';
+    return EXIT_FAILURE;
+  }
+  CommandLine commandLine{config.prefix};
+  if (auto status{ProcessCommandLine(request.args, commandLine)}) {
+    return *status;
+  }
+  if (!resident || commandLine.fortranSources.size() != 1 ||
+      ResidentKey(commandLine) != residentKey) {
+    return Compile(commandLine);
+  }
+  residentContext = &resident->context();
+  int status{Compile(commandLine)};
+  std::string names;
+  for (const auto &pair : resident->context().globalScope()) {
+    if (pair.second->test(Fortran::semantics::Symbol::Flag::ModFile)) {
+      names += pair.first.ToString() + '\n';
+    }
+  }
+  if (write(report, names.data(), names.size()) < 0) {
+    // the server will not learn of these modules
+  }
+  return status;
+}
+
+int RunServer(const std::string &socketPath, const CommandLine &config) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socketPath.size() >= sizeof address.sun_path) {
+    std::cerr << config.prefix << "socket path is too long: " << socketPath
+              << '\n';
+    return EXIT_FAILURE;
+  }
+  std::strcpy(address.sun_path, socketPath.c_str());
+  unlink(socketPath.c_str());
+  int listener{socket(AF_UNIX, SOCK_STREAM, 0)};
+  if (listener < 0 ||
+      bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof address) !=
+          0 ||
+      listen(listener, SOMAXCONN) != 0) {
+    std::cerr << config.prefix << "cannot listen on " << socketPath << ": "
+              << std::strerror(errno) << '\n';
+    return EXIT_FAILURE;
+  }
+  std::string residentKey{ResidentKey(config)};
+  std::unique_ptr<ResidentState> resident;
+  std::map<int, std::string> reports;  // from running requests
+  while (true) {
+    int connection{accept(listener, nullptr, nullptr)};
+    if (connection < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      std::cerr << config.prefix << "accept() failed: " << std::strerror(errno)
+                << '\n';
+      return EXIT_FAILURE;
+    }
+    while (waitpid(-1, nullptr, WNOHANG) > 0) {
+    }
+    std::optional<ServerRequest> request{ReceiveRequest(connection)};
+    if (!request) {
+      close(connection);
+      continue;
+    }
+    // Learn the modules read by completed requests.
+    std::set<std::string> learned;
+    for (auto iter{reports.begin()}; iter != reports.end();) {
+      char buffer[4096];
+      ssize_t got;
+      while ((got = read(iter->first, buffer, sizeof buffer)) > 0) {
+        iter->second.append(buffer, got);
+      }
+      if (got < 0 && errno == EAGAIN) {
+        ++iter;  // still running
+        continue;
+      }
+      std::istringstream names{iter->second};
+      for (std::string name; std::getline(names, name);) {
+        learned.insert(name);
+      }
+      close(iter->first);
+      iter = reports.erase(iter);
+    }
+    if (!resident || !resident->IsCurrent()) {
+      resident = std::make_unique<ResidentState>(config);
+    }
+    if (!learned.empty() && !resident->Read(learned)) {
+      resident = std::make_unique<ResidentState>(config);
+    }
+    int report[2];
+    if (pipe(report) != 0) {
+      report[0] = report[1] = -1;
+    }
+    pid_t pid{fork()};
+    if (pid == 0) {
+      close(listener);
+      close(report[0]);
+      for (int fd{0}; fd < requestFds; ++fd) {
+        dup2(request->fds[fd], fd);
+        close(request->fds[fd]);
+      }
+      int status{ServeRequest(
+          *request, config, resident.get(), residentKey, report[1])};
+      std::cout << std::flush;
+      char reply{static_cast<char>(status)};
+      if (write(connection, &reply, 1) != 1) {
+        status = EXIT_FAILURE;
+      }
+      exit(status);
+    }
+    close(connection);
+    close(report[1]);
+    for (int fd : request->fds) {
+      close(fd);
+    }
+    if (pid > 0 && report[0] >= 0) {
+      fcntl(report[0], F_SETFL, O_NONBLOCK);
+      reports.emplace(report[0], "");
+    } else if (report[0] >= 0) {
+      close(report[0]);
+    }
+  }
+}
+
+// Forwards a command line to a compilation server.  When no server is
+// listening on the socket, returns nothing so that the compilation
+// proceeds in this process.
+std::optional<int> RunClient(
+    const std::string &socketPath, const std::list<std::string> &args) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  int connection{socket(AF_UNIX, SOCK_STREAM, 0)};
+  if (connection < 0 || socketPath.size() >= sizeof address.sun_path) {
+    return std::nullopt;
+  }
+  std::strcpy(address.sun_path, socketPath.c_str());
+  if (connect(connection, reinterpret_cast<sockaddr *>(&address),
+          sizeof address) != 0) {
+    close(connection);
+    return std::nullopt;
+  }
+  char cwd[PATH_MAX];
+  std::string data{std::to_string(args.size() + 1)};
+  data += '\0';
+  data += getcwd(cwd, sizeof cwd) ? cwd : ".";
+  data += '\0';
+  for (const auto &arg : args) {
+    data += arg;
+    data += '\0';
+  }
+  int fds[requestFds]{STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO};
+  char control[CMSG_SPACE(sizeof fds)]{};
+  iovec iov{data.data(), data.size()};
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof control;
+  cmsghdr *cmsg{CMSG_FIRSTHDR(&msg)};
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof fds);
+  std::memcpy(CMSG_DATA(cmsg), fds, sizeof fds);
+  ssize_t sent{sendmsg(connection, &msg, 0)};
+  while (sent > 0 && static_cast<std::size_t>(sent) < data.size()) {
+    ssize_t more{write(connection, data.data() + sent, data.size() - sent)};
+    sent = more > 0 ? sent + more : more;
+  }
+  char reply;
+  int status{EXIT_FAILURE};
+  if (sent > 0 && read(connection, &reply, 1) == 1) {
+    status = static_cast<unsigned char>(reply);
+  }
+  close(connection);
+  return status;
+}
+
+int main(int argc, char *const argv[]) {
+
+  atexit(CleanUpAtExit);
+
+  std::list<std::string> args{argList(argc, argv)};
+  std::string prefix{args.front()};
+  args.pop_front();
+  prefix += ": ";
+
+  std::optional<std::string> serverSocket;
+  if (args.size() >= 2 && args.front() == "--client") {
+    args.pop_front();
+    std::string socketPath{std::move(args.front())};
+    args.pop_front();
+    if (auto status{RunClient(socketPath, args)}) {
+      return *status;
+    }
+  } else if (args.size() >= 2 && args.front() == "--server") {
+    args.pop_front();
+    serverSocket = std::move(args.front());
+    args.pop_front();
+  }
+
+  CommandLine commandLine{prefix};
+  if (auto status{ProcessCommandLine(args, commandLine)}) {
+    return *status;
+  }
+  if (serverSocket) {
+    return RunServer(*serverSocket, commandLine);
+  }
+  return Compile(commandLine);
+}